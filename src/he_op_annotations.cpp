@@ -30,7 +30,11 @@ HEOpAnnotations::HEOpAnnotations(bool from_client, bool encrypted, bool packed)
 
 bool HEOpAnnotations::operator==(const HEOpAnnotations& other) const {
   return (m_from_client == other.m_from_client) &&
-         (m_encrypted == other.m_encrypted) && (m_packed == other.m_packed);
+         (m_encrypted == other.m_encrypted) && (m_packed == other.m_packed) &&
+         (m_defer_relinearization == other.m_defer_relinearization) &&
+         (m_rescale == other.m_rescale) && (m_level == other.m_level) &&
+         (m_client_fused == other.m_client_fused) &&
+         (m_refresh == other.m_refresh);
 }
 
 bool HEOpAnnotations::from_client() const { return m_from_client; }
@@ -42,6 +46,25 @@ void HEOpAnnotations::set_encrypted(bool val) { m_encrypted = val; }
 bool HEOpAnnotations::packed() const { return m_packed; }
 void HEOpAnnotations::set_packed(bool val) { m_packed = val; }
 
+bool HEOpAnnotations::defer_relinearization() const {
+  return m_defer_relinearization;
+}
+void HEOpAnnotations::set_defer_relinearization(bool val) {
+  m_defer_relinearization = val;
+}
+
+bool HEOpAnnotations::rescale() const { return m_rescale; }
+void HEOpAnnotations::set_rescale(bool val) { m_rescale = val; }
+
+size_t HEOpAnnotations::level() const { return m_level; }
+void HEOpAnnotations::set_level(size_t val) { m_level = val; }
+
+bool HEOpAnnotations::client_fused() const { return m_client_fused; }
+void HEOpAnnotations::set_client_fused(bool val) { m_client_fused = val; }
+
+bool HEOpAnnotations::refresh() const { return m_refresh; }
+void HEOpAnnotations::set_refresh(bool val) { m_refresh = val; }
+
 bool HEOpAnnotations::has_he_annotation(const Node& op) {
   auto annotation = op.get_op_annotations();
   return std::dynamic_pointer_cast<HEOpAnnotations>(annotation) != nullptr;
@@ -72,6 +95,42 @@ bool HEOpAnnotations::plaintext_packed(const Node& op) {
   return false;
 }
 
+bool HEOpAnnotations::defer_relinearization(const Node& op) {
+  auto annotation = op.get_op_annotations();
+  if (auto he_annotation =
+          std::dynamic_pointer_cast<HEOpAnnotations>(annotation)) {
+    return he_annotation->defer_relinearization();
+  }
+  return false;
+}
+
+bool HEOpAnnotations::rescale(const Node& op) {
+  auto annotation = op.get_op_annotations();
+  if (auto he_annotation =
+          std::dynamic_pointer_cast<HEOpAnnotations>(annotation)) {
+    return he_annotation->rescale();
+  }
+  return false;
+}
+
+bool HEOpAnnotations::client_fused(const Node& op) {
+  auto annotation = op.get_op_annotations();
+  if (auto he_annotation =
+          std::dynamic_pointer_cast<HEOpAnnotations>(annotation)) {
+    return he_annotation->client_fused();
+  }
+  return false;
+}
+
+bool HEOpAnnotations::refresh(const Node& op) {
+  auto annotation = op.get_op_annotations();
+  if (auto he_annotation =
+          std::dynamic_pointer_cast<HEOpAnnotations>(annotation)) {
+    return he_annotation->refresh();
+  }
+  return false;
+}
+
 std::shared_ptr<HEOpAnnotations>
 HEOpAnnotations::server_plaintext_unpacked_annotation() {
   return std::make_shared<HEOpAnnotations>(false, false, false);
@@ -86,7 +145,23 @@ std::ostream& operator<<(std::ostream& os, const HEOpAnnotations& annotation) {
   os << "HEOpAnnotation{";
   os << "from_client=" << (annotation.from_client() ? "True" : "False") << ", ";
   os << "encrypted=" << (annotation.encrypted() ? "True" : "False") << ", ";
-  os << "packed=" << (annotation.packed() ? "True" : "False") << "}";
+  os << "packed=" << (annotation.packed() ? "True" : "False");
+  if (annotation.defer_relinearization()) {
+    os << ", defer_relinearization=True";
+  }
+  if (annotation.encrypted()) {
+    os << ", level=" << annotation.level();
+  }
+  if (annotation.rescale()) {
+    os << ", rescale=True";
+  }
+  if (annotation.client_fused()) {
+    os << ", client_fused=True";
+  }
+  if (annotation.refresh()) {
+    os << ", refresh=True";
+  }
+  os << "}";
   return os;
 }
 
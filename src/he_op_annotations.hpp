@@ -48,6 +48,33 @@ class HEOpAnnotations : public op::util::OpAnnotations {
   bool packed() const;
   void set_packed(bool val);
 
+  /// \brief Returns whether or not the op should accumulate unrelinearized
+  /// ciphertext-ciphertext products and relinearize each output only once
+  bool defer_relinearization() const;
+  void set_defer_relinearization(bool val);
+
+  /// \brief Returns whether or not the encrypted output of the op should be
+  /// rescaled after the op is computed
+  bool rescale() const;
+  void set_rescale(bool val);
+
+  /// \brief Returns the number of levels consumed by the encrypted output of
+  /// the op, i.e. the number of rescales applied since the last fresh
+  /// encryption
+  size_t level() const;
+  void set_level(size_t val);
+
+  /// \brief Returns whether or not the op is evaluated by the client within
+  /// the client round-trip of its consumer, rather than in its own round-trip
+  bool client_fused() const;
+  void set_client_fused(bool val);
+
+  /// \brief Returns whether or not the encrypted output of the op should be
+  /// refreshed by a client round-trip after the op is computed, resetting its
+  /// level
+  bool refresh() const;
+  void set_refresh(bool val);
+
   /// \brief Returns whether or not Op has HEOPAnnotations
   /// \param[in] op Operation to check for annotation
   static bool has_he_annotation(const Node& op);
@@ -67,6 +94,28 @@ class HEOpAnnotations : public op::util::OpAnnotations {
   /// \param[in] op Graph operation
   static bool plaintext_packed(const Node& op);
 
+  /// \brief Returns whether or not operation node should defer
+  /// relinearization of its ciphertext-ciphertext products. Defaults to false
+  /// if op has no HEOpAnnotation.
+  /// \param[in] op Graph operation
+  static bool defer_relinearization(const Node& op);
+
+  /// \brief Returns whether or not the output of the operation node should be
+  /// rescaled. Defaults to false if op has no HEOpAnnotation.
+  /// \param[in] op Graph operation
+  static bool rescale(const Node& op);
+
+  /// \brief Returns whether or not the operation node is evaluated by the
+  /// client within the client round-trip of its consumer. Defaults to false if
+  /// op has no HEOpAnnotation.
+  /// \param[in] op Graph operation
+  static bool client_fused(const Node& op);
+
+  /// \brief Returns whether or not the output of the operation node should be
+  /// refreshed by the client. Defaults to false if op has no HEOpAnnotation.
+  /// \param[in] op Graph operation
+  static bool refresh(const Node& op);
+
   static std::shared_ptr<HEOpAnnotations>
   server_plaintext_unpacked_annotation();
 
@@ -79,6 +128,11 @@ class HEOpAnnotations : public op::util::OpAnnotations {
   bool m_from_client = false;
   bool m_encrypted = false;
   bool m_packed = false;
+  bool m_defer_relinearization = false;
+  bool m_rescale = false;
+  size_t m_level = 0;
+  bool m_client_fused = false;
+  bool m_refresh = false;
 };
 
 std::ostream& operator<<(std::ostream& os, const HEOpAnnotations& annotation);
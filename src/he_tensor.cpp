@@ -16,6 +16,7 @@
 
 #include "he_tensor.hpp"
 
+#include <algorithm>
 #include <limits>
 #include <string>
 #include <utility>
@@ -24,19 +25,51 @@
 #include "ngraph/descriptor/tensor.hpp"
 #include "ngraph/util.hpp"
 #include "seal/he_seal_backend.hpp"
+#include "seal/seal_ciphertext_slab.hpp"
 #include "seal/seal_util.hpp"
 
 namespace ngraph::runtime::he {
+
+namespace {
+// Returns the pack axes of a tensor which is or is not packed along the batch
+// axis
+AxisSet batch_pack_axes(bool plaintext_packing) {
+  return plaintext_packing ? AxisSet{0} : AxisSet{};
+}
+
+// Returns the pack axes of a protobuf tensor
+AxisSet pack_axes_from_pb(const pb::HETensor& pb_tensor) {
+  if (!pb_tensor.packed()) {
+    return AxisSet{};
+  }
+  if (pb_tensor.pack_axes_size() == 0) {
+    return AxisSet{0};
+  }
+  return AxisSet{std::vector<size_t>{pb_tensor.pack_axes().begin(),
+                                     pb_tensor.pack_axes().end()}};
+}
+
+// Writes the pack axes to a protobuf tensor
+void pack_axes_to_pb(pb::HETensor& pb_tensor, const AxisSet& pack_axes) {
+  pb_tensor.set_packed(!pack_axes.empty());
+  pb_tensor.clear_pack_axes();
+  for (const auto& axis : pack_axes) {
+    pb_tensor.add_pack_axes(axis);
+  }
+}
+}  // namespace
+
 HETensor::HETensor(const element::Type& element_type, const Shape& shape,
-                   bool plaintext_packing, bool complex_packing, bool encrypted,
-                   seal::CKKSEncoder& ckks_encoder,
+                   const AxisSet& pack_axes, bool complex_packing,
+                   bool encrypted, seal::CKKSEncoder& ckks_encoder,
                    std::shared_ptr<seal::SEALContext> context,
                    const seal::Encryptor& encryptor, seal::Decryptor& decryptor,
                    const HESealEncryptionParameters& encryption_params,
                    const std::string& name)
     : runtime::Tensor(
           std::make_shared<descriptor::Tensor>(element_type, shape, name)),
-      m_packed(plaintext_packing),
+      m_pack_axes(pack_axes),
+      m_packed_shape(pack_shape(shape, pack_axes)),
       m_ckks_encoder(ckks_encoder),
       m_context(std::move(context)),
       m_encryptor(encryptor),
@@ -45,12 +78,6 @@ HETensor::HETensor(const element::Type& element_type, const Shape& shape,
   m_descriptor->set_tensor_layout(
       std::make_shared<descriptor::layout::DenseTensorLayout>(*m_descriptor));
 
-  if (plaintext_packing) {
-    m_packed_shape = pack_shape(shape, 0);
-  } else {
-    m_packed_shape = shape;
-  }
-
   size_t num_elements =
       (get_batch_size() != 0)
           ? m_descriptor->get_tensor_layout()->get_size() / get_batch_size()
@@ -69,21 +96,47 @@ HETensor::HETensor(const element::Type& element_type, const Shape& shape,
 
 HETensor::HETensor(const element::Type& element_type, const Shape& shape,
                    bool plaintext_packing, bool complex_packing, bool encrypted,
-                   const HESealBackend& he_seal_backend,
+                   seal::CKKSEncoder& ckks_encoder,
+                   std::shared_ptr<seal::SEALContext> context,
+                   const seal::Encryptor& encryptor, seal::Decryptor& decryptor,
+                   const HESealEncryptionParameters& encryption_params,
                    const std::string& name)
-    : HETensor(element_type, shape, plaintext_packing, complex_packing,
-               encrypted, *he_seal_backend.get_ckks_encoder(),
+    : HETensor(element_type, shape, batch_pack_axes(plaintext_packing),
+               complex_packing, encrypted, ckks_encoder, std::move(context),
+               encryptor, decryptor, encryption_params, name) {}
+
+HETensor::HETensor(const element::Type& element_type, const Shape& shape,
+                   const AxisSet& pack_axes, bool complex_packing,
+                   bool encrypted, const HESealBackend& he_seal_backend,
+                   const std::string& name)
+    : HETensor(element_type, shape, pack_axes, complex_packing, encrypted,
+               *he_seal_backend.get_ckks_encoder(),
                he_seal_backend.get_context(), *he_seal_backend.get_encryptor(),
                *he_seal_backend.get_decryptor(),
                he_seal_backend.get_encryption_parameters(), name) {}
 
+HETensor::HETensor(const element::Type& element_type, const Shape& shape,
+                   bool plaintext_packing, bool complex_packing, bool encrypted,
+                   const HESealBackend& he_seal_backend,
+                   const std::string& name)
+    : HETensor(element_type, shape, batch_pack_axes(plaintext_packing),
+               complex_packing, encrypted, he_seal_backend, name) {}
+
 Shape HETensor::pack_shape(const Shape& shape, size_t pack_axis) {
-  if (pack_axis != 0) {
-    throw ngraph_error("Packing only supported along axis 0");
-  }
+  return pack_shape(shape, AxisSet{pack_axis});
+}
+
+Shape HETensor::pack_shape(const Shape& shape, const AxisSet& pack_axes) {
   Shape packed_shape(shape);
-  if (!shape.empty() && shape[0] != 0) {
-    packed_shape[0] = 1;
+  if (shape.empty()) {
+    return packed_shape;
+  }
+  for (const auto& axis : pack_axes) {
+    NGRAPH_CHECK(axis < shape.size(), "Pack axis ", axis,
+                 " out of range for shape ", shape);
+    if (shape[axis] != 0) {
+      packed_shape[axis] = 1;
+    }
   }
   return packed_shape;
 }
@@ -91,45 +144,50 @@ Shape HETensor::pack_shape(const Shape& shape, size_t pack_axis) {
 Shape HETensor::unpack_shape(const Shape& shape, size_t pack_size,
                              size_t pack_axis) {
   Shape unpacked_shape(shape);
-
-  if (pack_axis != 0) {
-    throw ngraph_error("Unpacking only supported along axis 0");
+  if (shape.empty()) {
+    return unpacked_shape;
   }
-  if (!shape.empty() && shape[0] != 0) {
-    unpacked_shape[0] = pack_size;
+  NGRAPH_CHECK(pack_axis < shape.size(), "Pack axis ", pack_axis,
+               " out of range for shape ", shape);
+  if (shape[pack_axis] != 0) {
+    unpacked_shape[pack_axis] = pack_size;
   }
   return unpacked_shape;
 }
 
-void HETensor::pack(size_t pack_axis) {
-  NGRAPH_CHECK(pack_axis == 0, "Packing only supported along axis 0");
+void HETensor::pack(size_t pack_axis) { pack(AxisSet{pack_axis}); }
+
+void HETensor::pack(const AxisSet& pack_axes) {
   if (is_packed()) {
+    NGRAPH_CHECK(pack_axes == m_pack_axes, "Tensor already packed along ",
+                 m_pack_axes);
     return;
   }
   NGRAPH_CHECK(!any_encrypted_data(),
                "Packing only supported for plaintext tensors");
 
-  m_packed = true;
-  std::vector<HEType> new_data(m_data.size() / get_batch_size(),
-                               HEType(HEPlaintext(), false));
-  std::vector<HEPlaintext> new_plaintexts(new_data.size());
+  m_pack_axes = pack_axes;
+  m_packed_shape = pack_shape(get_shape(), m_pack_axes);
 
-  for (size_t idx = 0; idx < m_data.size(); ++idx) {
-    auto& plain = m_data[idx].get_plaintext();
-    if (!plain.empty()) {
-      size_t new_idx = idx % new_data.size();
-      new_plaintexts[new_idx].emplace_back(plain[0]);
-      new_data[new_idx].complex_packing() = m_data[idx].complex_packing();
-    }
-  }
+  std::vector<size_t> element_offsets;
+  std::vector<size_t> slot_offsets;
+  pack_offsets(shape_size(m_packed_shape), element_offsets, slot_offsets);
 
-  for (size_t idx = 0; idx < new_data.size(); ++idx) {
-    new_data[idx].set_plaintext(new_plaintexts[idx]);
+  std::vector<HEType> new_data(element_offsets.size(),
+                               HEType(HEPlaintext(), false));
+  for (size_t new_idx = 0; new_idx < new_data.size(); ++new_idx) {
+    HEPlaintext new_plaintext;
+    for (const auto& slot_offset : slot_offsets) {
+      const auto& old_data = m_data[element_offsets[new_idx] + slot_offset];
+      const auto& plain = old_data.get_plaintext();
+      if (!plain.empty()) {
+        new_plaintext.emplace_back(plain[0]);
+        new_data[new_idx].complex_packing() = old_data.complex_packing();
+      }
+    }
+    new_data[new_idx].set_plaintext(new_plaintext);
   }
-
   m_data = std::move(new_data);
-  m_packed = true;
-  m_packed_shape = HETensor::pack_shape(get_shape());
 }
 
 void HETensor::unpack() {
@@ -139,20 +197,63 @@ void HETensor::unpack() {
   NGRAPH_CHECK(!any_encrypted_data(),
                "Unpacking only supported for plaintext tensors");
 
-  size_t old_batch_size = get_batch_size();
-  m_packed = false;
-  std::vector<HEType> new_data;
-  for (size_t batch_idx = 0; batch_idx < old_batch_size; ++batch_idx) {
-    for (auto& data : m_data) {
-      auto& plain = data.get_plaintext();
-      new_data.emplace_back(
-          HEPlaintext({static_cast<double>(plain[batch_idx])}), false);
+  std::vector<size_t> element_offsets;
+  std::vector<size_t> slot_offsets;
+  pack_offsets(m_data.size(), element_offsets, slot_offsets);
+
+  std::vector<HEType> new_data(get_element_count(),
+                               HEType(HEPlaintext(), false));
+  for (size_t idx = 0; idx < m_data.size(); ++idx) {
+    const auto& plain = m_data[idx].get_plaintext();
+    for (size_t slot = 0; slot < slot_offsets.size(); ++slot) {
+      new_data[element_offsets[idx] + slot_offsets[slot]] = HEType(
+          HEPlaintext({static_cast<double>(plain[slot])}), false);
     }
   }
   m_data = std::move(new_data);
+  m_pack_axes = AxisSet{};
   m_packed_shape = get_shape();
 }
 
+void HETensor::pack_offsets(size_t num_elements,
+                            std::vector<size_t>& element_offsets,
+                            std::vector<size_t>& slot_offsets) const {
+  const Shape& shape = get_shape();
+  element_offsets = {0};
+  slot_offsets = {0};
+
+  // Expand offsets axis by axis, outermost first, to get row-major order
+  size_t stride = shape_size(shape);
+  for (size_t axis = 0; axis < shape.size(); ++axis) {
+    stride = (shape[axis] == 0) ? 0 : stride / shape[axis];
+    auto& offsets = (m_pack_axes.find(axis) != m_pack_axes.end())
+                        ? slot_offsets
+                        : element_offsets;
+    std::vector<size_t> new_offsets;
+    new_offsets.reserve(offsets.size() * shape[axis]);
+    for (const auto& offset : offsets) {
+      for (size_t coord = 0; coord < shape[axis]; ++coord) {
+        new_offsets.emplace_back(offset + coord * stride);
+      }
+    }
+    offsets = std::move(new_offsets);
+  }
+
+  if (num_elements != element_offsets.size()) {
+    // Partial access: values are strided by the number of elements accessed
+    NGRAPH_CHECK(m_pack_axes.empty() || m_pack_axes == AxisSet{0},
+                 "Partial access only supported for tensors packed along "
+                 "axis 0");
+    element_offsets.resize(num_elements);
+    for (size_t i = 0; i < num_elements; ++i) {
+      element_offsets[i] = i;
+    }
+    for (size_t j = 0; j < slot_offsets.size(); ++j) {
+      slot_offsets[j] = j * num_elements;
+    }
+  }
+}
+
 uint64_t HETensor::batch_size(const Shape& shape, bool packed) {
   if (packed && !shape.empty()) {
     return shape[0];
@@ -160,6 +261,16 @@ uint64_t HETensor::batch_size(const Shape& shape, bool packed) {
   return 1;
 }
 
+uint64_t HETensor::batch_size(const Shape& shape, const AxisSet& pack_axes) {
+  uint64_t size = 1;
+  for (const auto& axis : pack_axes) {
+    if (axis < shape.size()) {
+      size *= shape[axis];
+    }
+  }
+  return size;
+}
+
 size_t HETensor::get_batched_element_count() const {
   if (get_batch_size() == 0) {
     NGRAPH_CHECK(get_element_count() == 0,
@@ -169,6 +280,32 @@ size_t HETensor::get_batched_element_count() const {
   return get_element_count() / get_batch_size();
 }
 
+void HETensor::allocate_slab() {
+  if (!slab_storage() || slab_allocated()) {
+    return;
+  }
+  m_slab_pool = SealCiphertextSlab::create_pool(m_context, m_data.size());
+  NGRAPH_HE_LOG(5) << "Allocated ciphertext slab of "
+                   << m_slab_pool.alloc_byte_count() << " bytes for tensor "
+                   << get_name();
+
+  // Replace empty ciphertexts, so that they allocate from the slab
+  for (auto& he_type : m_data) {
+    if (he_type.is_ciphertext() &&
+        he_type.get_ciphertext()->ciphertext().size() == 0) {
+      he_type.set_ciphertext(
+          HESealBackend::create_empty_ciphertext(m_slab_pool));
+    }
+  }
+}
+
+seal::MemoryPoolHandle HETensor::ciphertext_pool() const {
+  if (slab_allocated()) {
+    return m_slab_pool;
+  }
+  return seal::MemoryManager::GetPool();
+}
+
 bool HETensor::any_encrypted_data() const {
   return std::any_of(m_data.begin(), m_data.end(), [](const HEType& he_type) {
     return he_type.is_ciphertext();
@@ -207,28 +344,55 @@ void HETensor::write(const void* p, size_t n) {
     num_elements_to_write /= get_batch_size();
   }
 
-#pragma omp parallel for
-  // NOLINTNEXTLINE
-  for (size_t i = 0; i < num_elements_to_write; ++i) {
+  if (any_encrypted_data()) {
+    allocate_slab();
+  }
+
+  std::vector<size_t> element_offsets;
+  std::vector<size_t> slot_offsets;
+  pack_offsets(num_elements_to_write, element_offsets, slot_offsets);
+
+#pragma omp parallel
+  {
+    // Per-thread scratch plaintext, reused across elements
     HEPlaintext plain(get_batch_size());
-    for (size_t j = 0; j < get_batch_size(); ++j) {
-      const auto* src = static_cast<const void*>(
-          static_cast<const char*>(p) +
-          type_byte_size * (i + j * num_elements_to_write));
-      plain[j] = type_to_double(src, element_type);
-    }
 
-    if (m_data[i].is_plaintext()) {
-      m_data[i].set_plaintext(plain);
-    } else {
-      NGRAPH_CHECK(m_data[i].is_ciphertext(),
-                   "Cannot write into tensor of unspecified type");
-      auto cipher = HESealBackend::create_empty_ciphertext();
-
-      encrypt(cipher, plain, m_context->first_parms_id(), element_type,
-              m_encryption_params.scale(), m_ckks_encoder, m_encryptor,
-              m_data[i].complex_packing());
-      m_data[i].set_ciphertext(cipher);
+#pragma omp for
+    // NOLINTNEXTLINE
+    for (size_t i = 0; i < num_elements_to_write; ++i) {
+      plain.resize(get_batch_size());
+      for (size_t j = 0; j < get_batch_size(); ++j) {
+        const auto* src = static_cast<const void*>(
+            static_cast<const char*>(p) +
+            type_byte_size * (element_offsets[i] + slot_offsets[j]));
+        plain[j] = type_to_double(src, element_type);
+      }
+
+      if (m_data[i].is_plaintext()) {
+        m_data[i].set_plaintext(plain);
+      } else {
+        NGRAPH_CHECK(m_data[i].is_ciphertext(),
+                     "Cannot write into tensor of unspecified type");
+        // Ciphertexts in a slab are re-encrypted in place to keep their slot,
+        // unless they are shared with another tensor
+        std::shared_ptr<SealCiphertextWrapper> cipher;
+        if (slab_allocated() && m_data[i].get_ciphertext().use_count() == 1) {
+          cipher = m_data[i].get_ciphertext();
+        } else {
+          cipher = HESealBackend::create_empty_ciphertext(ciphertext_pool());
+        }
+
+        if (m_zero_encryption_pool != nullptr) {
+          encrypt(cipher, plain, m_context->first_parms_id(), element_type,
+                  m_encryption_params.scale(), m_ckks_encoder,
+                  *m_zero_encryption_pool, m_data[i].complex_packing());
+        } else {
+          encrypt(cipher, plain, m_context->first_parms_id(), element_type,
+                  m_encryption_params.scale(), m_ckks_encoder, m_encryptor,
+                  m_data[i].complex_packing());
+        }
+        m_data[i].set_ciphertext(cipher);
+      }
     }
   }
   m_write_count += num_elements_to_write;
@@ -240,97 +404,162 @@ void HETensor::read(void* p, size_t n) const {
   size_t type_byte_size = element_type.size();
   size_t num_elements_to_read = n / (type_byte_size * get_batch_size());
 
-  auto copy_batch_values_to_src = [&](size_t element_idx, void* copy_target,
-                                      const void* type_values_src) {
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
-    auto* src = static_cast<char*>(const_cast<void*>(type_values_src));
-    for (size_t j = 0; j < get_batch_size(); ++j) {
-      auto* dst_with_offset = static_cast<void*>(
-          static_cast<char*>(copy_target) +
-          type_byte_size * (element_idx + j * num_elements_to_read));
-      std::memcpy(dst_with_offset, src, type_byte_size);
-      src += type_byte_size;
-    }
-  };
+  std::vector<size_t> element_offsets;
+  std::vector<size_t> slot_offsets;
+  pack_offsets(num_elements_to_read, element_offsets, slot_offsets);
+  read_values(p, 0, num_elements_to_read, element_offsets, slot_offsets);
+}
 
-#pragma omp parallel for
-  // NOLINTNEXTLINE
-  for (size_t i = 0; i < num_elements_to_read; ++i) {
-    HEPlaintext plain;
-    if (m_data[i].is_ciphertext()) {
-      decrypt(plain, *m_data[i].get_ciphertext(), m_data[i].complex_packing(),
-              m_decryptor, m_ckks_encoder, m_context, m_data[i].batch_size());
-    } else {
-      plain = m_data[i].get_plaintext();
-    }
+void HETensor::read_range(void* p, size_t offset, size_t count) const {
+  NGRAPH_CHECK(offset + count <= m_data.size(), "Range [", offset, ", ",
+               offset + count, ") past end of tensor with ", m_data.size(),
+               " values");
 
-    void* dst = ngraph_malloc(type_byte_size * get_batch_size());
-    plain.resize(get_batch_size());
-    plain.write(dst, element_type);
+  std::vector<size_t> element_offsets;
+  std::vector<size_t> slot_offsets;
+  pack_offsets(m_data.size(), element_offsets, slot_offsets);
+  read_values(p, offset, offset + count, element_offsets, slot_offsets);
+}
 
-    copy_batch_values_to_src(i, p, dst);
+void HETensor::read_values(void* p, size_t begin, size_t end,
+                           const std::vector<size_t>& element_offsets,
+                           const std::vector<size_t>& slot_offsets) const {
+  const element::Type& element_type = get_tensor_layout()->get_element_type();
+  size_t type_byte_size = element_type.size();
 
-    ngraph_free(dst);
+#pragma omp parallel
+  {
+    // Per-thread scratch plaintext, reused across elements
+    HEPlaintext plain;
+
+#pragma omp for
+    // NOLINTNEXTLINE
+    for (size_t i = begin; i < end; ++i) {
+      if (m_data[i].is_ciphertext()) {
+        decrypt(plain, *m_data[i].get_ciphertext(),
+                m_data[i].complex_packing(), m_decryptor, m_ckks_encoder,
+                m_context, m_data[i].batch_size());
+      } else {
+        plain = m_data[i].get_plaintext();
+      }
+      plain.resize(get_batch_size());
+
+      // Scatter batch values directly into their strided destinations
+      for (size_t j = 0; j < get_batch_size(); ++j) {
+        auto* dst = static_cast<void*>(
+            static_cast<char*>(p) +
+            type_byte_size * (element_offsets[i] + slot_offsets[j]));
+        double_to_type(plain[j], dst, element_type);
+      }
+    }
   }
 }
 
-std::vector<pb::HETensor> HETensor::write_to_pb_tensors() const {
-  std::vector<pb::HETensor> pb_tensors(1);
-  // Populate attributes of tensor to estimate byte size
-  pb_tensors[0].set_name(get_name());
-  std::vector<uint64_t> int_shape{get_shape()};
-  *pb_tensors[0].mutable_shape() = {int_shape.begin(), int_shape.end()};
-  pb_tensors[0].set_type(type_to_pb_type(get_element_type()));
-  pb_tensors[0].set_packed(m_packed);
-  pb_tensors[0].set_offset(0);
-
+void HETensor::write_to_pb_tensors(const PBTensorWriter& writer,
+                                   seal::compr_mode_type compr_mode,
+                                   bool encrypt_symmetric,
+                                   bool raw_ciphertexts,
+                                   size_t max_byte_count) const {
   NGRAPH_HE_LOG(5) << "Writing tensor shape " << get_shape();
 
-  if (!m_data.empty()) {
-    pb::HEType tmp_type;
-    m_data[0].save(tmp_type);
+  // Compressed ciphertexts must be serialized, so are not sent raw
+  raw_ciphertexts =
+      raw_ciphertexts && compr_mode == seal::compr_mode_type::none;
 
-    size_t he_type_size = tmp_type.ByteSize();
-    size_t max_num_data_per_tensor =
-        std::floor(std::numeric_limits<int32_t>::max() /
-                   static_cast<float>(he_type_size)) -
-        2;
+  std::vector<uint64_t> int_shape{get_shape()};
+  auto new_pb_tensor = [&](size_t offset) {
+    pb::HETensor pb_tensor;
+    pb_tensor.set_name(get_name());
+    *pb_tensor.mutable_shape() = {int_shape.begin(), int_shape.end()};
+    pb_tensor.set_type(type_to_pb_type(get_element_type()));
+    pack_axes_to_pb(pb_tensor, m_pack_axes);
+    pb_tensor.set_offset(offset);
+    return pb_tensor;
+  };
 
-    size_t num_tensors = m_data.size() / max_num_data_per_tensor;
-    if (m_data.size() % max_num_data_per_tensor != 0) {
-      num_tensors++;
+  if (m_data.empty()) {
+    writer(new_pb_tensor(0), CiphertextPayloads{});
+    return;
+  }
+
+  auto save_he_type = [&](const HEType& he_type, pb::HEType& pb_he_type,
+                          seal::compr_mode_type mode, size_t payload_index) {
+    if (raw_ciphertexts && he_type.is_ciphertext()) {
+      he_type.save_raw(pb_he_type, payload_index);
+    } else if (encrypt_symmetric && he_type.is_plaintext()) {
+      he_type.save_symmetric(pb_he_type, m_context->first_parms_id(),
+                             get_element_type(), m_encryption_params.scale(),
+                             m_ckks_encoder, m_encryptor, mode);
+    } else {
+      he_type.save(pb_he_type, mode);
+    }
+  };
+
+  // Estimate the serialized size of each value from the first value
+  pb::HEType tmp_type;
+  save_he_type(m_data[0], tmp_type, seal::compr_mode_type::none, 0);
+  size_t he_type_size = tmp_type.ByteSize();
+  if (m_data[0].is_ciphertext()) {
+    const auto& cipher = m_data[0].get_ciphertext()->ciphertext();
+    if (raw_ciphertexts) {
+      he_type_size += m_data[0].get_ciphertext()->byte_count();
+    } else if (compr_mode != seal::compr_mode_type::none) {
+      // Compressed sizes vary per ciphertext, so use SEAL's upper bound
+      he_type_size +=
+          ciphertext_size(cipher, compr_mode) - ciphertext_size(cipher);
+    }
+  }
+  size_t max_num_data_per_tensor = max_byte_count / he_type_size;
+  max_num_data_per_tensor =
+      max_num_data_per_tensor > 2 ? max_num_data_per_tensor - 2 : 1;
+
+  for (size_t offset = 0; offset < m_data.size();
+       offset += max_num_data_per_tensor) {
+    size_t num_data_in_tensor =
+        std::min(max_num_data_per_tensor, m_data.size() - offset);
+
+    pb::HETensor pb_tensor = new_pb_tensor(offset);
+    auto* mutable_data = pb_tensor.mutable_data();
+    mutable_data->Reserve(num_data_in_tensor);
+    for (size_t data_idx = 0; data_idx < num_data_in_tensor; ++data_idx) {
+      mutable_data->Add();
+    }
+    // Raw ciphertexts are indexed by their position in the proto tensor
+    CiphertextPayloads tensor_payloads;
+    if (raw_ciphertexts) {
+      tensor_payloads.assign(num_data_in_tensor, nullptr);
     }
-    pb_tensors.resize(num_tensors);
-
-    size_t offset = 0;
-
-    for (size_t tensor_idx = 0; tensor_idx < num_tensors; ++tensor_idx) {
-      pb_tensors[tensor_idx].set_name(get_name());
-      *pb_tensors[tensor_idx].mutable_shape() = {int_shape.begin(),
-                                                 int_shape.end()};
-      pb_tensors[tensor_idx].set_type(type_to_pb_type(get_element_type()));
-      pb_tensors[tensor_idx].set_packed(m_packed);
-      pb_tensors[tensor_idx].set_offset(offset);
-
-      auto* mutable_data = pb_tensors[tensor_idx].mutable_data();
-      size_t num_data_in_tensor = max_num_data_per_tensor;
-      if (tensor_idx == num_tensors - 1) {
-        num_data_in_tensor =
-            m_data.size() - tensor_idx * max_num_data_per_tensor;
-      }
-      for (size_t data_idx = 0; data_idx < num_data_in_tensor; ++data_idx) {
-        mutable_data->Add();
-      }
 
 #pragma omp parallel for
-      // NOLINTNEXTLINE
-      for (size_t data_idx = 0; data_idx < num_data_in_tensor; ++data_idx) {
-        size_t data_offset = offset + data_idx;
-        m_data[data_offset].save(*mutable_data->Mutable(data_idx));
+    // NOLINTNEXTLINE
+    for (size_t data_idx = 0; data_idx < num_data_in_tensor; ++data_idx) {
+      const auto& he_type = m_data[offset + data_idx];
+      save_he_type(he_type, *mutable_data->Mutable(data_idx), compr_mode,
+                   data_idx);
+      if (raw_ciphertexts && he_type.is_ciphertext()) {
+        tensor_payloads[data_idx] = he_type.get_ciphertext();
       }
-      offset += num_data_in_tensor;
     }
+    writer(std::move(pb_tensor), std::move(tensor_payloads));
+  }
+}
+
+std::vector<pb::HETensor> HETensor::write_to_pb_tensors(
+    seal::compr_mode_type compr_mode, bool encrypt_symmetric,
+    std::vector<CiphertextPayloads>* payloads) const {
+  std::vector<pb::HETensor> pb_tensors;
+  if (payloads != nullptr) {
+    payloads->clear();
   }
+  write_to_pb_tensors(
+      [&](pb::HETensor&& pb_tensor, CiphertextPayloads&& tensor_payloads) {
+        pb_tensors.emplace_back(std::move(pb_tensor));
+        if (payloads != nullptr) {
+          payloads->emplace_back(std::move(tensor_payloads));
+        }
+      },
+      compr_mode, encrypt_symmetric, payloads != nullptr,
+      std::numeric_limits<int32_t>::max());
   return pb_tensors;
 }
 
@@ -339,39 +568,39 @@ std::shared_ptr<HETensor> HETensor::load_from_pb_tensors(
     seal::CKKSEncoder& ckks_encoder,
     const std::shared_ptr<seal::SEALContext>& context,
     const seal::Encryptor& encryptor, seal::Decryptor& decryptor,
-    const HESealEncryptionParameters& encryption_params) {
-  NGRAPH_CHECK(pb_tensors.size() == 1,
-               "load_from_pb_tensors only supports 1 proto");
+    const HESealEncryptionParameters& encryption_params,
+    const std::vector<CiphertextPayloads>& payloads) {
+  NGRAPH_CHECK(!pb_tensors.empty(), "No proto tensors to load");
+  NGRAPH_CHECK(payloads.empty() || payloads.size() == pb_tensors.size(),
+               "Number of payloads (", payloads.size(),
+               ") does not match number of proto tensors (", pb_tensors.size(),
+               ")");
 
   const auto& pb_tensor = pb_tensors[0];
-  const auto& pb_name = pb_tensor.name();
   const auto& pb_shape = pb_tensor.shape();
   const auto& element_type = pb_type_to_type(pb_tensor.type());
-  const auto& pb_packed = pb_tensor.packed();
-  size_t result_count = pb_tensor.data_size();
+  const auto pb_pack_axes = pack_axes_from_pb(pb_tensor);
   Shape shape{pb_shape.begin(), pb_shape.end()};
 
   auto he_tensor = std::make_shared<HETensor>(
-      element_type, shape, pb_packed, encryption_params.complex_packing(),
+      element_type, shape, pb_pack_axes, encryption_params.complex_packing(),
       false, ckks_encoder, context, encryptor, decryptor, encryption_params,
-      pb_name);
+      pb_tensor.name());
 
-#pragma omp parallel for
-  // NOLINTNEXTLINE
-  for (size_t result_idx = 0; result_idx < result_count; ++result_idx) {
-    const auto& loaded = HEType::load(pb_tensor.data(result_idx), context);
-    he_tensor->data(result_idx) = loaded;
+  for (size_t tensor_idx = 0; tensor_idx < pb_tensors.size(); ++tensor_idx) {
+    load_from_pb_tensor(
+        he_tensor, pb_tensors[tensor_idx], context,
+        payloads.empty() ? CiphertextPayloads{} : payloads[tensor_idx]);
   }
-  he_tensor->m_write_count += result_count;
-
   return he_tensor;
 }
 
 void HETensor::load_from_pb_tensor(
     std::shared_ptr<HETensor>& he_tensor, const pb::HETensor& pb_tensor,
-    const std::shared_ptr<seal::SEALContext>& context) {
+    const std::shared_ptr<seal::SEALContext>& context,
+    const CiphertextPayloads& payloads) {
   const auto& pb_name = pb_tensor.name();
-  const auto& pb_packed = pb_tensor.packed();
+  const auto pb_pack_axes = pack_axes_from_pb(pb_tensor);
   const auto& pb_shape = pb_tensor.shape();
   const auto& pb_offset = pb_tensor.offset();
   size_t result_count = pb_tensor.data_size();
@@ -382,14 +611,17 @@ void HETensor::load_from_pb_tensor(
                he_tensor->get_shape(), ", expected ", shape);
   NGRAPH_CHECK(he_tensor->get_name() == pb_name, "HETensor has wrong name ",
                he_tensor->get_name(), ", expected ", pb_name);
-  NGRAPH_CHECK(he_tensor->is_packed() == pb_packed,
-               "HETensor has wrong packing ", he_tensor->is_packed(),
-               ", expected ", pb_packed);
+  NGRAPH_CHECK(he_tensor->get_pack_axes() == pb_pack_axes,
+               "HETensor has wrong pack axes ", he_tensor->get_pack_axes(),
+               ", expected ", pb_pack_axes);
+
+  he_tensor->allocate_slab();
 
 #pragma omp parallel for
   // NOLINTNEXTLINE
   for (size_t result_idx = 0; result_idx < result_count; ++result_idx) {
-    const auto& loaded = HEType::load(pb_tensor.data(result_idx), context);
+    const auto& loaded = HEType::load(pb_tensor.data(result_idx), context,
+                                      he_tensor->ciphertext_pool(), payloads);
     he_tensor->data(pb_offset + result_idx) = loaded;
   }
   he_tensor->m_write_count += result_count;
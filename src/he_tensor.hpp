@@ -16,17 +16,21 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "he_plaintext.hpp"
 #include "he_type.hpp"
+#include "ngraph/axis_set.hpp"
 #include "ngraph/runtime/tensor.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "protos/message.pb.h"
 #include "seal/he_seal_encryption_parameters.hpp"
 #include "seal/seal_ciphertext_wrapper.hpp"
+#include "seal/seal_zero_encryption_pool.hpp"
 
 namespace ngraph::runtime::he {
 class HESealBackend;
@@ -57,6 +61,29 @@ class HETensor : public runtime::Tensor {
            const HESealEncryptionParameters& encryption_params,
            const std::string& name = "external");
 
+  /// \brief Constructs a generic HETensor packed along the given axes
+  /// \param[in] element_type Datatype of data stored in the tensor
+  /// \param[in] shape Shape of tensor
+  /// \param[in] pack_axes Axes along which the tensor is stored using
+  /// plaintext packing. If empty, the tensor is not packed
+  /// \param[in] complex_packing Whether or not tensor is stored using
+  /// complex packing
+  /// \param[in] encrypted Whether or not tensor is initialized with ciphertexts
+  /// \param[in] ckks_encoder CKKS encoder to associate with loaded tensor
+  /// \param[in] context SEAL context to associate with loaded tensor
+  /// \param[in] encryptor SEAL encryptor to associate with loaded tensor
+  /// \param[in] decryptor SEAL decryptor to associate with loaded tensor
+  /// \param[in] encryption_params Encryption parameters to associate with
+  /// loaded tensor
+  /// \param[in] name Name of the tensor
+  HETensor(const element::Type& element_type, const Shape& shape,
+           const AxisSet& pack_axes, bool complex_packing, bool encrypted,
+           seal::CKKSEncoder& ckks_encoder,
+           std::shared_ptr<seal::SEALContext> context,
+           const seal::Encryptor& encryptor, seal::Decryptor& decryptor,
+           const HESealEncryptionParameters& encryption_params,
+           const std::string& name = "external");
+
   /// \brief Constructs a generic HETensor
   /// \param[in] element_type Datatype of data stored in the tensor
   /// \param[in] shape Shape of tensor
@@ -72,6 +99,21 @@ class HETensor : public runtime::Tensor {
            const HESealBackend& he_seal_backend,
            const std::string& name = "external");
 
+  /// \brief Constructs a generic HETensor packed along the given axes
+  /// \param[in] element_type Datatype of data stored in the tensor
+  /// \param[in] shape Shape of tensor
+  /// \param[in] pack_axes Axes along which the tensor is stored using
+  /// plaintext packing. If empty, the tensor is not packed
+  /// \param[in] complex_packing Whether or not tensor is stored using
+  /// complex packing
+  /// \param[in] encrypted Whether or not tensor is initialized with ciphertexts
+  /// \param[in] he_seal_backend Backend used for encryption and decryption
+  /// \param[in] name Name of the tensor
+  HETensor(const element::Type& element_type, const Shape& shape,
+           const AxisSet& pack_axes, bool complex_packing, bool encrypted,
+           const HESealBackend& he_seal_backend,
+           const std::string& name = "external");
+
   /// \brief Write bytes directly into the tensor
   /// \param[in] p Pointer to source of data
   /// \param[in] n Number of bytes to write, must be integral number of elements
@@ -82,12 +124,27 @@ class HETensor : public runtime::Tensor {
   /// \param[in] n Number of bytes to read, must be integral number of elements.
   void read(void* p, size_t n) const override;
 
+  /// \brief Reads a contiguous range of values, e.g. a chunk loaded from a
+  /// proto tensor, into their positions in a buffer holding the whole tensor.
+  /// Reading every range is equivalent to reading the whole tensor
+  /// \param[out] p Pointer to destination for the whole tensor's data
+  /// \param[in] offset Index of the first value to read
+  /// \param[in] count Number of values to read
+  void read_range(void* p, size_t offset, size_t count) const;
+
   /// \brief Reduces shape along pack axis
   /// \param[in] shape Input shape to pack
   /// \param[in] pack_axis Axis along which to pack
   /// \return Shape after packing along pack axis
   static Shape pack_shape(const Shape& shape, size_t pack_axis = 0);
 
+  /// \brief Reduces shape along pack axes
+  /// \param[in] shape Input shape to pack
+  /// \param[in] pack_axes Axes along which to pack
+  /// \return Shape after packing along pack axes
+  /// \throws ngraph_error if a pack axis is out of range
+  static Shape pack_shape(const Shape& shape, const AxisSet& pack_axes);
+
   /// \brief Expands shape along pack axis
   /// \param[in] shape Input shape to pack
   /// \param[in] pack_size New size of pack axis
@@ -101,6 +158,13 @@ class HETensor : public runtime::Tensor {
   /// \throws ngraph_error if tensor contains any encrypted data
   void pack(size_t pack_axis = 0);
 
+  /// \brief Packs the tensor along pack axes. Values at the same position in
+  /// the remaining axes are stored in the same plaintext, ordered row-major
+  /// over the pack axes
+  /// \param[in] pack_axes Axes along which to pack.
+  /// \throws ngraph_error if tensor contains any encrypted data
+  void pack(const AxisSet& pack_axes);
+
   /// \brief Unpacks the tensor
   /// \throws ngraph_error if tensor contains any encrypted data
   void unpack();
@@ -116,23 +180,71 @@ class HETensor : public runtime::Tensor {
   /// \param[in] packed Whether or not batch-axis packing is used
   static uint64_t batch_size(const Shape& shape, bool packed);
 
+  /// \brief Returns the number of values packed into each plaintext or
+  /// ciphertext for a given shape
+  /// \param[in] shape Shape of the tensor
+  /// \param[in] pack_axes Axes along which the tensor is packed
+  static uint64_t batch_size(const Shape& shape, const AxisSet& pack_axes);
+
   /// \brief Returns the shape of the un-expanded (i.e. packed) tensor.
   const Shape& get_packed_shape() const { return m_packed_shape; }
 
   /// \brief Returns plaintext packing factor used in the tensor
-  size_t get_batch_size() const { return batch_size(get_shape(), m_packed); }
+  size_t get_batch_size() const {
+    return batch_size(get_shape(), m_pack_axes);
+  }
 
   /// \brief Returns number of ciphertext / plaintext objects in the tensor
   size_t get_batched_element_count() const;
 
   /// \brief Returns whether or not the tensor is packed
-  bool is_packed() const { return m_packed; }
+  bool is_packed() const { return !m_pack_axes.empty(); }
+
+  /// \brief Returns the axes along which the tensor is packed
+  const AxisSet& get_pack_axes() const { return m_pack_axes; }
+
+  /// \brief Callback receiving a proto tensor and its raw ciphertext payloads
+  using PBTensorWriter =
+      std::function<void(pb::HETensor&&, CiphertextPayloads&&)>;
+
+  /// \brief Maximum size in bytes of a proto tensor written by the tensor,
+  /// including its raw ciphertext payloads
+  static constexpr size_t max_pb_tensor_byte_count = 1UL << 27;
+
+  /// \brief Writes the tensor as a stream of proto tensors, each storing a
+  /// contiguous range of the tensor's values. Each proto tensor is passed to
+  /// the writer as soon as it is encoded, so the serialized tensor is never
+  /// held in memory at once
+  /// \param[in] writer Called with each proto tensor, in order of offset
+  /// \param[in] compr_mode Compression mode used to serialize ciphertexts
+  /// \param[in] encrypt_symmetric Whether or not to encrypt plaintext values
+  /// with seeded symmetric encryption as they are written
+  /// \param[in] raw_ciphertexts Whether or not to send uncompressed
+  /// ciphertexts as raw payloads, rather than copying them into the proto
+  /// tensors
+  /// \param[in] max_byte_count Maximum size of a proto tensor, including its
+  /// raw payloads. At least one value is written per proto tensor
+  void write_to_pb_tensors(
+      const PBTensorWriter& writer, seal::compr_mode_type compr_mode,
+      bool encrypt_symmetric = false, bool raw_ciphertexts = false,
+      size_t max_byte_count = max_pb_tensor_byte_count) const;
 
   /// \brief Writes the tensor to a vector of proto tensors.
   /// Due to the 2GB limit on protobufs, large ciphertext tensors may not be
   /// able to store the entire tensor in one SealCipherTensor message.
+  /// \param[in] compr_mode Compression mode used to serialize ciphertexts
+  /// \param[in] encrypt_symmetric Whether or not to encrypt plaintext values
+  /// with seeded symmetric encryption as they are written. Requires the
+  /// tensor's encryptor to hold the secret key
+  /// \param[out] payloads If not null, uncompressed ciphertexts are not
+  /// copied into the proto tensors. Instead, the proto tensors store only
+  /// their metadata, and the ciphertexts are returned as the raw payloads of
+  /// a binary frame, one entry per proto tensor
   /// returns vector of pb_tensors
-  std::vector<pb::HETensor> write_to_pb_tensors() const;
+  std::vector<pb::HETensor> write_to_pb_tensors(
+      seal::compr_mode_type compr_mode = seal::compr_mode_type::none,
+      bool encrypt_symmetric = false,
+      std::vector<CiphertextPayloads>* payloads = nullptr) const;
 
   /// \brief Loads a tensor from protobuf tensors
   /// \param[in] pb_tensors vector of protobuf tensors to load from
@@ -142,13 +254,17 @@ class HETensor : public runtime::Tensor {
   /// \param[in] decryptor SEAL decryptor to associate with loaded tensor
   /// \param[in] encryption_params Encryption parameters to associate with
   /// loaded tensor
+  /// \param[in] payloads Raw ciphertext payloads of the binary frames storing
+  /// the protobuf tensors, one entry per protobuf tensor. May be empty if no
+  /// ciphertexts are raw
   /// \returns Pointer to loaded tensor
   static std::shared_ptr<HETensor> load_from_pb_tensors(
       const std::vector<pb::HETensor>& pb_tensors,
       seal::CKKSEncoder& ckks_encoder,
       const std::shared_ptr<seal::SEALContext>& context,
       const seal::Encryptor& encryptor, seal::Decryptor& decryptor,
-      const HESealEncryptionParameters& encryption_params);
+      const HESealEncryptionParameters& encryption_params,
+      const std::vector<CiphertextPayloads>& payloads = {});
 
   /// \brief Loads a tensor from protobuf tensor
   /// \param[in] pb_tensor protobuf tensor to load from
@@ -158,28 +274,62 @@ class HETensor : public runtime::Tensor {
   /// \param[in] decryptor SEAL decryptor to associate with loaded tensor
   /// \param[in] encryption_params Encryption parameters to associate with
   /// loaded tensor
+  /// \param[in] payloads Raw ciphertext payloads of the binary frame storing
+  /// the protobuf tensor
   /// \returns Pointer to loaded tensor
   static std::shared_ptr<HETensor> load_from_pb_tensor(
       const pb::HETensor& pb_tensor, seal::CKKSEncoder& ckks_encoder,
       const std::shared_ptr<seal::SEALContext>& context,
       const seal::Encryptor& encryptor, seal::Decryptor& decryptor,
-      const HESealEncryptionParameters& encryption_params) {
+      const HESealEncryptionParameters& encryption_params,
+      const CiphertextPayloads& payloads = {}) {
     return load_from_pb_tensors({pb_tensor}, ckks_encoder, context, encryptor,
-                                decryptor, encryption_params);
+                                decryptor, encryption_params,
+                                std::vector<CiphertextPayloads>{payloads});
   }
 
   /// \brief Loads a tensor from protobuf tensor to an he_tensor
   /// \param[in] he_tensor Tensor to load to
   /// \param[in] pb_tensor protobuf tensor to load from
   /// \param[in] context SEAL context to associate with loaded tensor
+  /// \param[in] payloads Raw ciphertext payloads of the binary frame storing
+  /// the protobuf tensor
   static void load_from_pb_tensor(
       std::shared_ptr<HETensor>& he_tensor, const pb::HETensor& pb_tensor,
-      const std::shared_ptr<seal::SEALContext>& context);
+      const std::shared_ptr<seal::SEALContext>& context,
+      const CiphertextPayloads& payloads = {});
 
   bool done_loading() const { return m_write_count == m_data.size(); }
 
+  /// \brief Stores the tensor's ciphertexts in a single contiguous slab,
+  /// rather than in one allocation per ciphertext. Ciphertexts subsequently
+  /// written to or loaded into the tensor allocate from the slab. The slab is
+  /// allocated on the first such write or load, so tensors whose ciphertexts
+  /// are produced by kernels never allocate one
+  void enable_slab_storage() { m_slab_storage = true; }
+
+  /// \brief Returns whether or not the tensor stores ciphertexts written to
+  /// or loaded into it in a contiguous slab
+  bool slab_storage() const { return m_slab_storage; }
+
+  /// \brief Returns whether or not the tensor's slab has been allocated
+  bool slab_allocated() const { return static_cast<bool>(m_slab_pool); }
+
+  /// \brief Returns the memory pool backed by the tensor's slab. Only valid
+  /// if slab_allocated() is true
+  const seal::MemoryPoolHandle& slab_pool() const { return m_slab_pool; }
+
+  /// \brief Sets a pool of precomputed encryptions of zero, which write()
+  /// uses to encrypt values at the first parms_id
+  /// \param[in] zero_encryption_pool Pool of encryptions of zero. If nullptr,
+  /// values are encrypted directly
+  void set_zero_encryption_pool(
+      std::shared_ptr<SealZeroEncryptionPool> zero_encryption_pool) {
+    m_zero_encryption_pool = std::move(zero_encryption_pool);
+  }
+
  private:
-  bool m_packed;
+  AxisSet m_pack_axes;
   Shape m_packed_shape;
   std::vector<HEType> m_data;
 
@@ -191,7 +341,37 @@ class HETensor : public runtime::Tensor {
   seal::Decryptor& m_decryptor;
   const HESealEncryptionParameters& m_encryption_params;
 
+  // Slab storing the ciphertexts, allocated on the first write or load if
+  // slab storage is enabled
+  bool m_slab_storage{false};
+  seal::MemoryPoolHandle m_slab_pool;
+
+  std::shared_ptr<SealZeroEncryptionPool> m_zero_encryption_pool;
+
   void check_io_bounds(size_t n) const;
+
+  /// \brief Allocates the slab, if slab storage is enabled and the slab has
+  /// not been allocated yet
+  void allocate_slab();
+
+  /// \brief Computes the row-major offsets into the unpacked tensor of each
+  /// packed element and of each slot within a packed element. The value in
+  /// slot j of element i is at offset element_offsets[i] + slot_offsets[j]
+  /// \param[in] num_elements Number of packed elements accessed
+  /// \param[out] element_offsets Offset of each packed element
+  /// \param[out] slot_offsets Offset of each slot
+  void pack_offsets(size_t num_elements, std::vector<size_t>& element_offsets,
+                    std::vector<size_t>& slot_offsets) const;
+
+  /// \brief Decrypts values [begin, end) into their offsets, as computed by
+  /// pack_offsets, in the destination buffer
+  void read_values(void* p, size_t begin, size_t end,
+                   const std::vector<size_t>& element_offsets,
+                   const std::vector<size_t>& slot_offsets) const;
+
+  /// \brief Returns the memory pool new ciphertexts in the tensor allocate
+  /// from
+  seal::MemoryPoolHandle ciphertext_pool() const;
 };
 
 }  // namespace ngraph::runtime::he
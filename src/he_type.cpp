@@ -16,16 +16,59 @@
 
 #include "he_type.hpp"
 
+#include <algorithm>
+#include <cstring>
 #include <memory>
+#include <string>
+#include <type_traits>
 #include <utility>
 
 #include "he_plaintext.hpp"
+#include "ngraph/check.hpp"
+#include "ngraph/except.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "protos/message.pb.h"
 #include "seal/he_seal_backend.hpp"
 #include "seal/seal_ciphertext_wrapper.hpp"
+#include "seal/seal_util.hpp"
+#include "seal/valcheck.h"
 
 namespace ngraph::runtime::he {
+namespace {
+/// \brief Packs plaintext values into a binary blob of values of type T
+template <typename T>
+void save_plain_data(const HEPlaintext& plain, std::string& output) {
+  output.resize(plain.size() * sizeof(T));
+  char* dst = output.data();
+  if constexpr (std::is_same_v<T, double>) {
+    std::memcpy(dst, plain.data(), output.size());
+  } else {
+    for (size_t i = 0; i < plain.size(); ++i) {
+      auto value = static_cast<T>(plain[i]);
+      std::memcpy(dst + i * sizeof(T), &value, sizeof(T));
+    }
+  }
+}
+
+/// \brief Unpacks a binary blob of values of type T into a plaintext
+template <typename T>
+HEPlaintext load_plain_data(const std::string& input) {
+  NGRAPH_CHECK(input.size() % sizeof(T) == 0, "Plaintext data size ",
+               input.size(), " is not a multiple of ", sizeof(T));
+  HEPlaintext plain(input.size() / sizeof(T));
+  const char* src = input.data();
+  if constexpr (std::is_same_v<T, double>) {
+    std::memcpy(plain.data(), src, input.size());
+  } else {
+    for (size_t i = 0; i < plain.size(); ++i) {
+      T value;
+      std::memcpy(&value, src + i * sizeof(T), sizeof(T));
+      plain[i] = static_cast<double>(value);
+    }
+  }
+  return plain;
+}
+}  // namespace
 
 HEType::HEType(const HEPlaintext& plain, bool complex_packing)
     : HEType(complex_packing, plain.size()) {
@@ -41,37 +84,98 @@ HEType::HEType(const std::shared_ptr<SealCiphertextWrapper>& cipher,
 }
 
 HEType HEType::load(const pb::HEType& pb_he_type,
-                    std::shared_ptr<seal::SEALContext> context) {
+                    std::shared_ptr<seal::SEALContext> context,
+                    const seal::MemoryPoolHandle& pool,
+                    const CiphertextPayloads& payloads) {
   if (pb_he_type.is_plaintext()) {
-    // TODO(fboemer): HEPlaintext::load function
-    HEPlaintext vals;
-    for (const auto value : pb_he_type.plain()) {
-      vals.emplace_back(static_cast<double>(value));
+    if (pb_he_type.plain_size() > 0) {
+      const auto& values = pb_he_type.plain();
+      HEPlaintext vals(values.size());
+      std::copy(values.begin(), values.end(), vals.begin());
+      return HEType(vals, pb_he_type.complex_packing());
+    }
+    const auto& data = pb_he_type.plain_data();
+    auto encoding = pb_he_type.plain_encoding();
+    if (encoding == pb::PlainEncoding::PLAIN_F64) {
+      return HEType(load_plain_data<double>(data),
+                    pb_he_type.complex_packing());
     }
-    return HEType(vals, pb_he_type.complex_packing());
+    if (encoding == pb::PlainEncoding::PLAIN_F32) {
+      return HEType(load_plain_data<float>(data), pb_he_type.complex_packing());
+    }
+    throw ngraph_error("Unknown plaintext encoding " +
+                       std::to_string(encoding));
+  }
+
+  if (pb_he_type.has_raw_ciphertext()) {
+    size_t index = pb_he_type.raw_ciphertext().index();
+    NGRAPH_CHECK(index < payloads.size() && payloads[index] != nullptr,
+                 "Missing raw ciphertext payload ", index);
+    const auto& cipher = payloads[index];
+    NGRAPH_CHECK(seal::is_valid_for(cipher->ciphertext(), context),
+                 "Raw ciphertext payload ", index, " is invalid");
+    return HEType(cipher, pb_he_type.complex_packing(),
+                  pb_he_type.batch_size());
   }
 
-  auto cipher = HESealBackend::create_empty_ciphertext();
+  auto cipher = HESealBackend::create_empty_ciphertext(pool);
   SealCiphertextWrapper::load(*cipher, pb_he_type, std::move(context));
   return HEType(cipher, pb_he_type.complex_packing(), pb_he_type.batch_size());
 }
 
-void HEType::save(pb::HEType& pb_he_type) const {
+void HEType::save(pb::HEType& pb_he_type, seal::compr_mode_type compr_mode,
+                  pb::PlainEncoding plain_encoding) const {
   pb_he_type.set_is_plaintext(is_plaintext());
   pb_he_type.set_plaintext_packing(plaintext_packing());
   pb_he_type.set_complex_packing(complex_packing());
   pb_he_type.set_batch_size(batch_size());
 
   if (is_plaintext()) {
-    // TODO(fboemer): more efficient
-    for (auto& elem : get_plaintext()) {
-      pb_he_type.add_plain(static_cast<float>(elem));
+    pb_he_type.set_plain_encoding(plain_encoding);
+    auto* plain_data = pb_he_type.mutable_plain_data();
+    if (plain_encoding == pb::PlainEncoding::PLAIN_F64) {
+      save_plain_data<double>(get_plaintext(), *plain_data);
+    } else if (plain_encoding == pb::PlainEncoding::PLAIN_F32) {
+      save_plain_data<float>(get_plaintext(), *plain_data);
+    } else {
+      throw ngraph_error("Unknown plaintext encoding " +
+                         std::to_string(plain_encoding));
     }
   } else {
-    get_ciphertext()->save(pb_he_type);
+    get_ciphertext()->save(pb_he_type, compr_mode);
   }
 }
 
+void HEType::save_raw(pb::HEType& pb_he_type, size_t index) const {
+  NGRAPH_CHECK(is_ciphertext(), "Only ciphertexts can be saved raw");
+  pb_he_type.set_is_plaintext(false);
+  pb_he_type.set_plaintext_packing(plaintext_packing());
+  pb_he_type.set_complex_packing(complex_packing());
+  pb_he_type.set_batch_size(batch_size());
+
+  auto* raw_cipher = pb_he_type.mutable_raw_ciphertext();
+  get_ciphertext()->save_metadata(*raw_cipher);
+  raw_cipher->set_index(index);
+}
+
+void HEType::save_symmetric(pb::HEType& pb_he_type,
+                            seal::parms_id_type parms_id,
+                            const element::Type& element_type, double scale,
+                            seal::CKKSEncoder& ckks_encoder,
+                            const seal::Encryptor& encryptor,
+                            seal::compr_mode_type compr_mode) const {
+  NGRAPH_CHECK(is_plaintext(),
+               "Symmetric encryption requires a plaintext HEType");
+  pb_he_type.set_is_plaintext(false);
+  pb_he_type.set_plaintext_packing(plaintext_packing());
+  pb_he_type.set_complex_packing(complex_packing());
+  pb_he_type.set_batch_size(batch_size());
+
+  encrypt_symmetric_save(*pb_he_type.mutable_ciphertext(), get_plaintext(),
+                         parms_id, element_type, scale, ckks_encoder,
+                         encryptor, complex_packing(), compr_mode);
+}
+
 void HEType::set_plaintext(HEPlaintext plain) {
   m_plain = std::move(plain);
   m_is_plain = true;
@@ -36,10 +36,50 @@ class HEType {
   HEType(const std::shared_ptr<SealCiphertextWrapper>& cipher,
          bool complex_packing, size_t batch_size);
 
-  void save(pb::HEType& pb_he_type) const;
-
-  static HEType load(const pb::HEType& pb_he_type,
-                     std::shared_ptr<seal::SEALContext> context);
+  /// \brief Writes the HEType to a protobuf object
+  /// \param[out] pb_he_type Protobuf object to write to
+  /// \param[in] compr_mode Compression mode used to serialize a ciphertext
+  /// \param[in] plain_encoding Binary encoding of plaintext values. PLAIN_F64
+  /// is exact; PLAIN_F32 halves the size at single precision
+  void save(
+      pb::HEType& pb_he_type,
+      seal::compr_mode_type compr_mode = seal::compr_mode_type::none,
+      pb::PlainEncoding plain_encoding = pb::PlainEncoding::PLAIN_F64) const;
+
+  /// \brief Writes the metadata of a ciphertext HEType to a protobuf object.
+  /// The ciphertext data is sent as a raw payload of a binary frame
+  /// \param[out] pb_he_type Protobuf object to write to
+  /// \param[in] index Index of the ciphertext in the frame's payloads
+  /// \throws ngraph_error if the HEType is a plaintext
+  void save_raw(pb::HEType& pb_he_type, size_t index) const;
+
+  /// \brief Encrypts a plaintext HEType with seeded symmetric encryption and
+  /// writes the ciphertext to a protobuf object
+  /// \param[out] pb_he_type Protobuf object to write to
+  /// \param[in] parms_id Seal parameter id to use in encoding
+  /// \param[in] element_type Datatype used for encoding
+  /// \param[in] scale Scale at which to encode value
+  /// \param[in] ckks_encoder Used for encoding
+  /// \param[in] encryptor Used for encrypting. Must hold the secret key
+  /// \param[in] compr_mode Compression mode used to serialize the ciphertext
+  /// \throws ngraph_error if the HEType is a ciphertext
+  void save_symmetric(
+      pb::HEType& pb_he_type, seal::parms_id_type parms_id,
+      const element::Type& element_type, double scale,
+      seal::CKKSEncoder& ckks_encoder, const seal::Encryptor& encryptor,
+      seal::compr_mode_type compr_mode = seal::compr_mode_type::none) const;
+
+  /// \brief Loads an HEType from a protobuf object. Ciphertexts saved with
+  /// seeded symmetric encryption are expanded to full ciphertexts
+  /// \param[in] pb_he_type Protobuf object to load from
+  /// \param[in] context SEAL context to validate loaded ciphertext against
+  /// \param[in] pool Memory pool used to allocate a loaded ciphertext
+  /// \param[in] payloads Ciphertexts read from the raw payloads of a binary
+  /// frame. A raw ciphertext is used in place, without copying
+  static HEType load(
+      const pb::HEType& pb_he_type, std::shared_ptr<seal::SEALContext> context,
+      const seal::MemoryPoolHandle& pool = seal::MemoryManager::GetPool(),
+      const CiphertextPayloads& payloads = {});
 
   bool is_plaintext() const { return m_is_plain; }
   bool is_ciphertext() const { return !is_plaintext(); }
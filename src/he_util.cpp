@@ -16,6 +16,7 @@
 
 #include "he_util.hpp"
 
+#include <cmath>
 #include <complex>
 #include <map>
 #include <string>
@@ -107,6 +108,45 @@ double type_to_double(const void* src, const element::Type& element_type) {
 #pragma clang diagnostic pop
 }
 
+void double_to_type(double value, void* dst,
+                    const element::Type& element_type) {
+#pragma clang diagnostic push
+#pragma clang diagnostic error "-Wswitch"
+#pragma clang diagnostic error "-Wswitch-enum"
+  switch (element_type.get_type_enum()) {
+    case element::Type_t::f32: {
+      *static_cast<float*>(dst) = static_cast<float>(value);
+      break;
+    }
+    case element::Type_t::f64: {
+      *static_cast<double*>(dst) = value;
+      break;
+    }
+    case element::Type_t::i32: {
+      *static_cast<int32_t*>(dst) = static_cast<int32_t>(std::round(value));
+      break;
+    }
+    case element::Type_t::i64: {
+      *static_cast<int64_t*>(dst) = static_cast<int64_t>(std::round(value));
+      break;
+    }
+    case element::Type_t::i8:
+    case element::Type_t::i16:
+    case element::Type_t::u1:
+    case element::Type_t::u8:
+    case element::Type_t::u16:
+    case element::Type_t::u32:
+    case element::Type_t::u64:
+    case element::Type_t::dynamic:
+    case element::Type_t::undefined:
+    case element::Type_t::bf16:
+    case element::Type_t::f16:
+    case element::Type_t::boolean:
+      NGRAPH_CHECK(false, "Unsupported element type ", element_type);
+  }
+#pragma clang diagnostic pop
+}
+
 bool param_originates_from_name(const op::Parameter& param,
                                 const std::string& name) {
   if (param.get_name() == name) {
@@ -125,6 +125,14 @@ inline int flag_to_int(const std::string& flag, int default_value = 0) {
 /// \returns double value
 double type_to_double(const void* src, const element::Type& element_type);
 
+/// \brief Converts a double to a type, rounding to the nearest integer for
+/// integral types
+/// \param[in] value Value to convert
+/// \param[out] dst Destination to which to write
+/// \param[in] element_type Datatype to write to destination
+void double_to_type(double value, void* dst,
+                    const element::Type& element_type);
+
 bool param_originates_from_name(const op::Parameter& param,
                                 const std::string& name);
 
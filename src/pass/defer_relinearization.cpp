@@ -0,0 +1,63 @@
+//*****************************************************************************
+// Copyright 2018-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "pass/defer_relinearization.hpp"
+
+#include <list>
+#include <memory>
+
+#include "he_op_annotations.hpp"
+#include "logging/ngraph_he_log.hpp"
+#include "ngraph/function.hpp"
+#include "ngraph/node.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/op.hpp"
+
+namespace ngraph::runtime::he {
+
+bool pass::DeferRelinearization::run_on_function(
+    std::shared_ptr<Function> function) {
+  std::list<std::shared_ptr<Node>> nodes = function->get_ordered_ops();
+
+  NGRAPH_HE_LOG(3) << "Running Defer Relinearization pass";
+
+  for (const auto& node : nodes) {
+    if (!node->is_op() || !HEOpAnnotations::has_he_annotation(*node)) {
+      continue;
+    }
+    auto he_op_annotations = HEOpAnnotations::he_op_annotation(*node);
+
+    bool defer = is_type<op::Dot>(node) || is_type<op::Convolution>(node);
+    for (const auto& input : node->inputs()) {
+      if (!defer) {
+        break;
+      }
+      const Node* arg = input.get_source_output().get_node();
+      defer = HEOpAnnotations::has_he_annotation(*arg) &&
+              HEOpAnnotations::he_op_annotation(*arg)->encrypted();
+    }
+
+    if (defer) {
+      NGRAPH_HE_LOG(5) << "Deferring relinearization for op "
+                       << node->get_name();
+    }
+    he_op_annotations->set_defer_relinearization(defer);
+  }
+  return false;
+}
+
+}  // namespace ngraph::runtime::he
@@ -0,0 +1,63 @@
+//*****************************************************************************
+// Copyright 2018-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "pass/fuse_client_ops.hpp"
+
+#include <list>
+#include <memory>
+
+#include "he_op_annotations.hpp"
+#include "logging/ngraph_he_log.hpp"
+#include "ngraph/function.hpp"
+#include "ngraph/node.hpp"
+#include "ngraph/op/max_pool.hpp"
+#include "ngraph/op/relu.hpp"
+#include "op/bounded_relu.hpp"
+
+namespace ngraph::runtime::he {
+
+bool pass::FuseClientOps::run_on_function(std::shared_ptr<Function> function) {
+  std::list<std::shared_ptr<Node>> nodes = function->get_ordered_ops();
+
+  NGRAPH_HE_LOG(3) << "Running Fuse Client Ops pass";
+
+  for (const auto& node : nodes) {
+    if (!node->is_op() || !HEOpAnnotations::has_he_annotation(*node)) {
+      continue;
+    }
+    auto he_op_annotations = HEOpAnnotations::he_op_annotation(*node);
+
+    // Garbled circuits mask the activation output, whereas a fused client
+    // round-trip decrypts the activation input
+    bool fuse = !m_garbled_circuits &&
+                (is_type<op::Relu>(node) || is_type<op::BoundedRelu>(node)) &&
+                he_op_annotations->encrypted() && !node->is_output();
+    if (fuse) {
+      const auto& targets = node->output(0).get_target_inputs();
+      fuse = targets.size() == 1 &&
+             is_type<op::MaxPool>(targets.begin()->get_node());
+    }
+
+    if (fuse) {
+      NGRAPH_HE_LOG(5) << "Fusing op " << node->get_name()
+                       << " into client round-trip of its consumer";
+    }
+    he_op_annotations->set_client_fused(fuse);
+  }
+  return false;
+}
+
+}  // namespace ngraph::runtime::he
@@ -0,0 +1,48 @@
+//*****************************************************************************
+// Copyright 2018-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+
+#include "ngraph/pass/graph_rewrite.hpp"
+
+namespace ngraph::runtime::he::pass {
+/// \brief Fuses adjacent client-evaluated ops into a single client
+/// round-trip. Annotates encrypted Relu and BoundedRelu ops whose only
+/// consumer is a MaxPool op as client-fused. Such activations are evaluated by
+/// the client within the MaxPool round-trip: since the activations are
+/// monotonic, the client applies the activation to each pooled maximum. No ops
+/// are fused when garbled circuits are enabled, since the fused round-trip
+/// reveals the pre-activation values to the client. Should be run after
+/// PropagateHEAnnotations
+class FuseClientOps : public ngraph::pass::FunctionPass {
+ public:
+  /// \brief Constructs the pass
+  /// \param[in] garbled_circuits Whether or not activations are evaluated
+  /// using garbled circuits, in which case no ops are fused
+  explicit FuseClientOps(bool garbled_circuits = false)
+      : m_garbled_circuits(garbled_circuits) {}
+
+  /// \brief Runs pass on function
+  /// \param[in,out] function Function which to run pass on
+  /// \returns whether or not the function has been modified
+  bool run_on_function(std::shared_ptr<Function> function) override;
+
+ private:
+  bool m_garbled_circuits;
+};
+}  // namespace ngraph::runtime::he::pass
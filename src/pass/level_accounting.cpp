@@ -0,0 +1,137 @@
+//*****************************************************************************
+// Copyright 2018-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "pass/level_accounting.hpp"
+
+#include <algorithm>
+#include <list>
+#include <memory>
+
+#include "he_op_annotations.hpp"
+#include "logging/ngraph_he_log.hpp"
+#include "ngraph/function.hpp"
+#include "ngraph/node.hpp"
+#include "ngraph/ops.hpp"
+#include "op/bounded_relu.hpp"
+
+namespace ngraph::runtime::he {
+
+bool pass::LevelAccounting::is_rescale_op(const Node& node) {
+  return is_type<op::AvgPool>(&node) || is_type<op::Convolution>(&node) ||
+         is_type<op::Dot>(&node) || is_type<op::Multiply>(&node);
+}
+
+bool pass::LevelAccounting::is_refresh_op(const Node& node) const {
+  return is_type<op::BoundedRelu>(&node) || is_type<op::Exp>(&node) ||
+         is_type<op::Max>(&node) || is_type<op::MaxPool>(&node) ||
+         is_type<op::Minimum>(&node) || is_type<op::Power>(&node) ||
+         is_type<op::Relu>(&node) || is_type<op::Softmax>(&node) ||
+         m_client_ops.find(node.description()) != m_client_ops.end();
+}
+
+namespace {
+/// \brief Returns the largest level of the encrypted arguments of a node, as
+/// seen by the node, i.e. zero for refreshed arguments
+size_t arg_level(const Node& node) {
+  size_t level = 0;
+  for (const auto& input : node.inputs()) {
+    const Node* arg = input.get_source_output().get_node();
+    if (HEOpAnnotations::has_he_annotation(*arg)) {
+      auto arg_annotations = HEOpAnnotations::he_op_annotation(*arg);
+      if (arg_annotations->encrypted() && !arg_annotations->refresh()) {
+        level = std::max(level, arg_annotations->level());
+      }
+    }
+  }
+  return level;
+}
+}  // namespace
+
+bool pass::LevelAccounting::run_on_function(
+    std::shared_ptr<Function> function) {
+  std::list<std::shared_ptr<Node>> nodes = function->get_ordered_ops();
+
+  NGRAPH_HE_LOG(3) << "Running Level Accounting pass";
+
+  for (const auto& node : nodes) {
+    if (HEOpAnnotations::has_he_annotation(*node)) {
+      HEOpAnnotations::he_op_annotation(*node)->set_refresh(false);
+    }
+  }
+  m_refresh_count = 0;
+  assign_levels(nodes, true);
+
+  // Refreshes lower the levels of ops planned before them, so re-assign
+  if (m_refresh_count > 0) {
+    assign_levels(nodes, false);
+  }
+  NGRAPH_HE_LOG(3) << "Function consumes " << m_levels_consumed
+                   << " levels with " << m_refresh_count << " refreshes";
+  return false;
+}
+
+void pass::LevelAccounting::assign_levels(
+    const std::list<std::shared_ptr<Node>>& nodes, bool plan_refreshes) {
+  m_levels_consumed = 0;
+  for (const auto& node : nodes) {
+    if (!node->is_op() || !HEOpAnnotations::has_he_annotation(*node)) {
+      continue;
+    }
+    auto he_op_annotations = HEOpAnnotations::he_op_annotation(*node);
+
+    if (!he_op_annotations->encrypted()) {
+      he_op_annotations->set_level(0);
+      he_op_annotations->set_rescale(false);
+      continue;
+    }
+
+    // Level of an op is the largest level of its encrypted inputs
+    size_t level = is_refresh_op(*node) ? 0 : arg_level(*node);
+
+    bool rescale = is_rescale_op(*node);
+    if (rescale) {
+      level++;
+    }
+
+    // Refresh each argument at the maximum level once, for all its consumers
+    if (plan_refreshes && level > m_max_level && m_max_level > 0) {
+      for (const auto& input : node->inputs()) {
+        Node* arg = input.get_source_output().get_node();
+        if (!HEOpAnnotations::has_he_annotation(*arg)) {
+          continue;
+        }
+        auto arg_annotations = HEOpAnnotations::he_op_annotation(*arg);
+        if (arg_annotations->encrypted() && !arg_annotations->refresh() &&
+            arg_annotations->level() >= m_max_level) {
+          NGRAPH_HE_LOG(5) << "Refreshing output of " << arg->get_name()
+                           << " at level " << arg_annotations->level();
+          arg_annotations->set_refresh(true);
+          m_refresh_count++;
+        }
+      }
+      level = arg_level(*node) + 1;
+    }
+    he_op_annotations->set_rescale(rescale);
+    he_op_annotations->set_level(level);
+
+    NGRAPH_HE_LOG(5) << "Op " << node->get_name() << " has level " << level
+                     << (rescale ? " (rescaled)" : "");
+
+    m_levels_consumed = std::max(m_levels_consumed, level);
+  }
+}
+
+}  // namespace ngraph::runtime::he
@@ -0,0 +1,94 @@
+//*****************************************************************************
+// Copyright 2018-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <limits>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <utility>
+
+#include "ngraph/node.hpp"
+#include "ngraph/pass/graph_rewrite.hpp"
+
+namespace ngraph::runtime::he::pass {
+/// \brief Accounts for the coefficient modulus level of each encrypted tensor
+/// in the function. Annotates each op with the number of levels its encrypted
+/// output has consumed, and whether or not the output is rescaled, which is the
+/// case for ops which multiply encrypted data. Plaintext-only branches are
+/// assigned no level, since plaintexts are encoded at the level of the
+/// ciphertext operand they are used with. When a rescale would exceed the
+/// maximum level, the encrypted arguments at the maximum level are annotated
+/// to be refreshed by a client round-trip. The levels consumed are used to
+/// choose the encryption parameters. Compile-time placement of rescales and
+/// mod-switches is deferred: operands whose levels differ are still matched
+/// at runtime by match_modulus_and_scale_inplace and
+/// match_to_smallest_chain_index. Should be run after PropagateHEAnnotations
+class LevelAccounting : public ngraph::pass::FunctionPass {
+ public:
+  /// \brief Constructs the pass
+  /// \param[in] max_level Maximum level of any encrypted tensor, i.e. the
+  /// number of rescales the coefficient modulus chain supports. Defaults to no
+  /// maximum, in which case no refreshes are planned
+  /// \param[in] client_ops Names of ops evaluated by the client, whose
+  /// outputs are fresh ciphertexts
+  explicit LevelAccounting(
+      size_t max_level = std::numeric_limits<size_t>::max(),
+      std::unordered_set<std::string> client_ops = {})
+      : m_max_level(max_level), m_client_ops(std::move(client_ops)) {}
+
+  /// \brief Runs pass on function
+  /// \param[in,out] function Function which to run pass on
+  /// \returns whether or not the function has been modified
+  bool run_on_function(std::shared_ptr<Function> function) override;
+
+  /// \brief Returns the maximum number of levels consumed by any encrypted
+  /// tensor in the function, i.e. the number of rescales the coefficient
+  /// modulus chain must support
+  size_t levels_consumed() const { return m_levels_consumed; }
+
+  /// \brief Returns the number of ops whose outputs are refreshed by the
+  /// client
+  size_t refresh_count() const { return m_refresh_count; }
+
+  /// \brief Returns whether or not the encrypted output of a node requires a
+  /// rescale
+  /// \param[in] node Node to check
+  static bool is_rescale_op(const Node& node);
+
+  /// \brief Returns whether or not a node decrypts and re-encrypts its
+  /// encrypted input, e.g. via a client, yielding fresh ciphertexts. Includes
+  /// the client ops the pass was constructed with
+  /// \param[in] node Node to check
+  bool is_refresh_op(const Node& node) const;
+
+ private:
+  /// \brief Annotates each encrypted op with its level and whether or not it
+  /// is rescaled
+  /// \param[in] nodes Ops in topological order
+  /// \param[in] plan_refreshes Whether or not to annotate arguments to be
+  /// refreshed when an op would exceed the maximum level
+  void assign_levels(const std::list<std::shared_ptr<Node>>& nodes,
+                     bool plan_refreshes);
+
+  size_t m_max_level;
+  std::unordered_set<std::string> m_client_ops;
+  size_t m_levels_consumed{0};
+  size_t m_refresh_count{0};
+};
+}  // namespace ngraph::runtime::he::pass
@@ -0,0 +1,202 @@
+//*****************************************************************************
+// Copyright 2018-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "seal/client_op_registry.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+#include "ngraph/check.hpp"
+#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/op/max.hpp"
+#include "ngraph/op/softmax.hpp"
+#include "ngraph/shape_util.hpp"
+
+namespace ngraph::runtime::he {
+
+namespace {
+/// \brief Returns a kernel applying op to each batch slot of each value
+ClientOpKernel unary_elementwise_kernel(std::function<double(double)> op) {
+  return [op](const std::vector<std::vector<HEPlaintext>>& args,
+              const std::vector<Shape>& /* arg_shapes */,
+              std::vector<HEPlaintext>& out, const Shape& /* out_shape */,
+              const nlohmann::json& /* attributes */) {
+    NGRAPH_CHECK(args.size() == 1, "Expected 1 argument, got ", args.size());
+    for (size_t out_idx = 0; out_idx < out.size(); ++out_idx) {
+      const auto& arg = args[0][out_idx];
+      out[out_idx].resize(arg.size());
+      std::transform(arg.begin(), arg.end(), out[out_idx].begin(), op);
+    }
+  };
+}
+
+/// \brief Returns a kernel applying op to each batch slot of each pair of
+/// values
+ClientOpKernel binary_elementwise_kernel(
+    std::function<double(double, double)> op) {
+  return [op](const std::vector<std::vector<HEPlaintext>>& args,
+              const std::vector<Shape>& /* arg_shapes */,
+              std::vector<HEPlaintext>& out, const Shape& /* out_shape */,
+              const nlohmann::json& /* attributes */) {
+    NGRAPH_CHECK(args.size() == 2, "Expected 2 arguments, got ", args.size());
+    for (size_t out_idx = 0; out_idx < out.size(); ++out_idx) {
+      const auto& arg0 = args[0][out_idx];
+      const auto& arg1 = args[1][out_idx];
+      NGRAPH_CHECK(arg0.size() == arg1.size(), "Argument batch sizes ",
+                   arg0.size(), " and ", arg1.size(), " don't match");
+      out[out_idx].resize(arg0.size());
+      std::transform(arg0.begin(), arg0.end(), arg1.begin(),
+                     out[out_idx].begin(), op);
+    }
+  };
+}
+
+nlohmann::json axes_to_json(const AxisSet& axes) {
+  return std::vector<size_t>(axes.begin(), axes.end());
+}
+
+AxisSet axes_from_json(const nlohmann::json& attributes) {
+  return AxisSet{attributes.at("axes").get<std::vector<size_t>>()};
+}
+
+/// \brief Computes the maximum of arg along the reduction axes
+void max_reduce(const std::vector<HEPlaintext>& arg, const Shape& arg_shape,
+                std::vector<HEPlaintext>& out, const Shape& out_shape,
+                const AxisSet& reduction_axes) {
+  size_t batch_size = arg.empty() ? 0 : arg[0].size();
+  out.assign(shape_size(out_shape),
+             HEPlaintext(batch_size, -std::numeric_limits<double>::infinity()));
+
+  CoordinateTransform output_transform(out_shape);
+  CoordinateTransform input_transform(arg_shape);
+  for (const Coordinate& input_coord : input_transform) {
+    size_t out_idx =
+        output_transform.index(reduce(input_coord, reduction_axes));
+    const auto& value = arg[input_transform.index(input_coord)];
+    for (size_t slot = 0; slot < batch_size; ++slot) {
+      out[out_idx][slot] = std::max(out[out_idx][slot], value[slot]);
+    }
+  }
+}
+
+void max_kernel(const std::vector<std::vector<HEPlaintext>>& args,
+                const std::vector<Shape>& arg_shapes,
+                std::vector<HEPlaintext>& out, const Shape& out_shape,
+                const nlohmann::json& attributes) {
+  NGRAPH_CHECK(args.size() == 1, "Expected 1 argument, got ", args.size());
+  max_reduce(args[0], arg_shapes[0], out, out_shape,
+             axes_from_json(attributes));
+}
+
+void softmax_kernel(const std::vector<std::vector<HEPlaintext>>& args,
+                    const std::vector<Shape>& arg_shapes,
+                    std::vector<HEPlaintext>& out,
+                    const Shape& /* out_shape */,
+                    const nlohmann::json& attributes) {
+  NGRAPH_CHECK(args.size() == 1, "Expected 1 argument, got ", args.size());
+  const auto& arg = args[0];
+  const Shape& shape = arg_shapes[0];
+  AxisSet axes = axes_from_json(attributes);
+  Shape reduced_shape = reduce(shape, axes);
+
+  // Subtract the maximum for numerical stability
+  std::vector<HEPlaintext> max_values;
+  max_reduce(arg, shape, max_values, reduced_shape, axes);
+
+  size_t batch_size = arg.empty() ? 0 : arg[0].size();
+  std::vector<HEPlaintext> sums(shape_size(reduced_shape),
+                                HEPlaintext(batch_size, 0));
+  CoordinateTransform transform(shape);
+  CoordinateTransform reduced_transform(reduced_shape);
+  for (const Coordinate& coord : transform) {
+    size_t idx = transform.index(coord);
+    size_t reduced_idx = reduced_transform.index(reduce(coord, axes));
+    out[idx].resize(batch_size);
+    for (size_t slot = 0; slot < batch_size; ++slot) {
+      out[idx][slot] = std::exp(arg[idx][slot] - max_values[reduced_idx][slot]);
+      sums[reduced_idx][slot] += out[idx][slot];
+    }
+  }
+  for (const Coordinate& coord : transform) {
+    size_t idx = transform.index(coord);
+    size_t reduced_idx = reduced_transform.index(reduce(coord, axes));
+    for (size_t slot = 0; slot < batch_size; ++slot) {
+      out[idx][slot] /= sums[reduced_idx][slot];
+    }
+  }
+}
+}  // namespace
+
+ClientOpRegistry::ClientOpRegistry() {
+  register_op(refresh_op_name,
+              unary_elementwise_kernel([](double x) { return x; }));
+  register_op("Exp",
+              unary_elementwise_kernel([](double x) { return std::exp(x); }));
+  register_op("Sigmoid", unary_elementwise_kernel([](double x) {
+                return 1. / (1. + std::exp(-x));
+              }));
+  register_op("Divide", binary_elementwise_kernel(
+                            [](double x, double y) { return x / y; }));
+  register_op("Minimum", binary_elementwise_kernel([](double x, double y) {
+                return std::min(x, y);
+              }));
+  register_op("Max", max_kernel, [](const Node& node) {
+    const auto& max = static_cast<const op::Max&>(node);
+    return nlohmann::json{{"axes", axes_to_json(max.get_reduction_axes())}};
+  });
+  register_op("Softmax", softmax_kernel, [](const Node& node) {
+    const auto& softmax = static_cast<const op::Softmax&>(node);
+    return nlohmann::json{{"axes", axes_to_json(softmax.get_axes())}};
+  });
+}
+
+ClientOpRegistry& ClientOpRegistry::instance() {
+  static ClientOpRegistry s_registry;
+  return s_registry;
+}
+
+void ClientOpRegistry::register_op(const std::string& name,
+                                   ClientOpKernel kernel,
+                                   ClientOpAttributes attributes) {
+  NGRAPH_CHECK(kernel != nullptr, "Client op ", name, " has no kernel");
+  m_client_ops.insert_or_assign(
+      name, ClientOp{std::move(kernel), std::move(attributes)});
+}
+
+bool ClientOpRegistry::is_registered(const std::string& name) const {
+  return m_client_ops.find(name) != m_client_ops.end();
+}
+
+const ClientOpRegistry::ClientOp& ClientOpRegistry::client_op(
+    const std::string& name) const {
+  auto it = m_client_ops.find(name);
+  NGRAPH_CHECK(it != m_client_ops.end(), "Op ", name,
+               " is not a registered client op");
+  return it->second;
+}
+
+const ClientOpKernel& ClientOpRegistry::kernel(const std::string& name) const {
+  return client_op(name).kernel;
+}
+
+nlohmann::json ClientOpRegistry::attributes(const Node& node) const {
+  const auto& op = client_op(node.description());
+  return op.attributes ? op.attributes(node) : nlohmann::json::object();
+}
+
+}  // namespace ngraph::runtime::he
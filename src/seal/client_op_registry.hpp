@@ -0,0 +1,92 @@
+//*****************************************************************************
+// Copyright 2018-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "he_plaintext.hpp"
+#include "ngraph/node.hpp"
+#include "ngraph/shape.hpp"
+#include "nlohmann/json.hpp"
+
+namespace ngraph::runtime::he {
+/// \brief Evaluates an op on decrypted values
+/// \param[in] args Argument values. Each value stores one entry per batch slot
+/// \param[in] arg_shapes Packed shapes of the arguments
+/// \param[out] out Output values, one per element of out_shape
+/// \param[in] out_shape Packed shape of the output
+/// \param[in] attributes Op attributes, as returned by the op's
+/// ClientOpAttributes
+using ClientOpKernel = std::function<void(
+    const std::vector<std::vector<HEPlaintext>>& args,
+    const std::vector<Shape>& arg_shapes, std::vector<HEPlaintext>& out,
+    const Shape& out_shape, const nlohmann::json& attributes)>;
+
+/// \brief Returns the attributes of an op the client needs to evaluate it
+using ClientOpAttributes = std::function<nlohmann::json(const Node&)>;
+
+/// \brief Registry of ops which the server can offload to the client. The
+/// server sends the arguments of a client op to the client, which decrypts
+/// them, evaluates the op and returns the encrypted result. The executable
+/// handles batching, level matching, chunking and result reassembly for every
+/// registered op. Relu, BoundedRelu and MaxPool use dedicated round-trips, so
+/// are not registered
+class ClientOpRegistry {
+ public:
+  /// \brief Name of the identity op, which re-encrypts its argument at the
+  /// first level. Used to refresh tensors marked by LevelAccounting
+  static constexpr const char* refresh_op_name = "Refresh";
+
+  /// \brief Returns the registry, initialized with the built-in client ops
+  static ClientOpRegistry& instance();
+
+  /// \brief Registers an op evaluated by the client
+  /// \param[in] name Op name, as returned by Node::description()
+  /// \param[in] kernel Evaluates the op on the client
+  /// \param[in] attributes Returns the attributes the kernel needs. If null,
+  /// the op has no attributes
+  void register_op(const std::string& name, ClientOpKernel kernel,
+                   ClientOpAttributes attributes = nullptr);
+
+  /// \brief Returns whether or not an op with the given name is registered
+  bool is_registered(const std::string& name) const;
+
+  /// \brief Returns the kernel of a registered op
+  /// \throws ngraph_error if the op is not registered
+  const ClientOpKernel& kernel(const std::string& name) const;
+
+  /// \brief Returns the attributes of a node of a registered op
+  /// \throws ngraph_error if the op is not registered
+  nlohmann::json attributes(const Node& node) const;
+
+ private:
+  ClientOpRegistry();
+
+  struct ClientOp {
+    ClientOpKernel kernel;
+    ClientOpAttributes attributes;
+  };
+
+  const ClientOp& client_op(const std::string& name) const;
+
+  std::unordered_map<std::string, ClientOp> m_client_ops;
+};
+
+}  // namespace ngraph::runtime::he
@@ -18,6 +18,7 @@
 
 #include <algorithm>
 #include <array>
+#include <fstream>
 #include <limits>
 #include <memory>
 #include <utility>
@@ -26,6 +27,9 @@
 #include "ngraph/runtime/backend_manager.hpp"
 #include "ngraph/util.hpp"
 #include "nlohmann/json.hpp"
+#include "pass/level_accounting.hpp"
+#include "pass/propagate_he_annotations.hpp"
+#include "seal/client_op_registry.hpp"
 #include "seal/he_seal_executable.hpp"
 #include "seal/seal.h"
 #include "seal/seal_util.hpp"
@@ -91,7 +95,12 @@ bool HESealBackend::set_config(const std::map<std::string, std::string>& config,
         NGRAPH_HE_LOG(3) << "Enabling client from config";
         m_enable_client = true;
       }
+    } else if (option == "encryption_parameters" &&
+               to_lower(setting) == "auto") {
+      NGRAPH_HE_LOG(3) << "Enabling automatic encryption parameters";
+      m_auto_encryption_parameters = true;
     } else if (option == "encryption_parameters") {
+      m_auto_encryption_parameters = false;
       auto new_parms = HESealEncryptionParameters::parse_config_or_use_default(
           setting.c_str());
       update_encryption_parameters(new_parms);
@@ -118,9 +127,43 @@ bool HESealBackend::set_config(const std::map<std::string, std::string>& config,
       } else {
         NGRAPH_HE_LOG(3) << "Not masking garbled circuits outputs from config";
       }
+    } else if (option == "precision_bits") {
+      m_precision_bits = flag_to_int(setting.c_str(), 24);
+      NGRAPH_HE_LOG(3) << "Setting " << m_precision_bits
+                       << " precision bits from config";
+    } else if (option == "integer_bits") {
+      m_integer_bits = flag_to_int(setting.c_str(), 6);
+      NGRAPH_HE_LOG(3) << "Setting " << m_integer_bits
+                       << " integer bits from config";
+    } else if (option == "max_levels") {
+      int max_levels = flag_to_int(setting.c_str(), 0);
+      NGRAPH_CHECK(max_levels > 0, "max_levels must be positive, got ",
+                   setting);
+      m_max_levels = static_cast<size_t>(max_levels);
+      NGRAPH_HE_LOG(3) << "Setting " << m_max_levels << " max levels";
+    } else if (option == "save_encryption_parameters") {
+      m_save_encryption_parameters_path = setting;
+    } else if (option == "codec") {
+      m_codec = parse_codec(setting);
+      NGRAPH_HE_LOG(3) << "Setting preferred codec " << codec_name(m_codec);
+      if (!codec_supported(m_codec)) {
+        NGRAPH_WARN << "Codec " << codec_name(m_codec)
+                    << " not supported by SEAL; using none";
+        m_codec = pb::CODEC_NONE;
+      }
     } else if (option == "port") {
       m_port = flag_to_int(setting.c_str(), 34000);
       NGRAPH_HE_LOG(3) << "Setting " << m_port << " port number";
+    } else if (option == "socket_path") {
+      m_socket_path = setting;
+      NGRAPH_HE_LOG(3) << "Setting Unix domain socket path " << m_socket_path;
+    } else if (option == "client_ops") {
+      for (const auto& op_name : split(setting, ',')) {
+        NGRAPH_CHECK(ClientOpRegistry::instance().is_registered(op_name),
+                     "Op ", op_name, " cannot be evaluated by the client");
+        NGRAPH_HE_LOG(3) << "Evaluating " << op_name << " ops on the client";
+        m_client_ops.insert(op_name);
+      }
     } else {
       std::string lower_option = to_lower(option);
       std::vector<std::string> lower_settings = split(to_lower(setting), ',');
@@ -172,6 +215,24 @@ bool HESealBackend::set_config(const std::map<std::string, std::string>& config,
   return true;
 }
 
+void HESealBackend::choose_encryption_parameters(size_t levels) {
+  auto new_parms = HESealEncryptionParameters::choose_parameters(
+      levels, m_precision_bits, m_integer_bits,
+      m_encryption_params.security_level(),
+      m_encryption_params.complex_packing());
+
+  std::string parms_json = new_parms.to_json_string();
+  NGRAPH_HE_LOG(1) << "Chose encryption parameters for " << levels
+                   << " levels: " << parms_json;
+  if (!m_save_encryption_parameters_path.empty()) {
+    std::ofstream parms_file(m_save_encryption_parameters_path);
+    NGRAPH_CHECK(parms_file.is_open(), "Unable to open file ",
+                 m_save_encryption_parameters_path);
+    parms_file << parms_json << "\n";
+  }
+  update_encryption_parameters(new_parms);
+}
+
 void HESealBackend::update_encryption_parameters(
     const HESealEncryptionParameters& new_parms) {
   if (HESealEncryptionParameters::same_context(m_encryption_params,
@@ -201,6 +262,9 @@ std::shared_ptr<runtime::Tensor> HESealBackend::create_cipher_tensor(
     const std::string& name) const {
   auto tensor = std::make_shared<HETensor>(
       type, shape, plaintext_packing, complex_packing(), true, *this, name);
+  if (slab_storage()) {
+    tensor->enable_slab_storage();
+  }
   return std::static_pointer_cast<runtime::Tensor>(tensor);
 }
 
@@ -208,6 +272,9 @@ std::shared_ptr<runtime::Tensor> HESealBackend::create_packed_cipher_tensor(
     const element::Type& type, const Shape& shape) const {
   auto tensor = std::make_shared<HETensor>(type, shape, true, complex_packing(),
                                            true, *this);
+  if (slab_storage()) {
+    tensor->enable_slab_storage();
+  }
   return std::static_pointer_cast<runtime::Tensor>(tensor);
 }
 
@@ -249,14 +316,35 @@ std::shared_ptr<runtime::Executable> HESealBackend::compile(
     }
   }
 
+  if (m_auto_encryption_parameters) {
+    // Conservatively assume client inputs are encrypted
+    for (auto& param : function->get_parameters()) {
+      if (HEOpAnnotations::from_client(*param)) {
+        HEOpAnnotations::he_op_annotation(*param)->set_encrypted(true);
+      }
+    }
+    ngraph::pass::Manager pass_manager;
+    pass_manager.set_pass_visualization(false);
+    pass_manager.set_pass_serialization(false);
+    pass_manager.register_pass<pass::PropagateHEAnnotations>();
+    // Without a client, tensors cannot be refreshed
+    auto level_accounting = pass_manager.register_pass<pass::LevelAccounting>(
+        m_enable_client ? m_max_levels : std::numeric_limits<size_t>::max(),
+        client_ops());
+    pass_manager.run_passes(function);
+
+    choose_encryption_parameters(level_accounting->levels_consumed());
+  }
+
   return std::dynamic_pointer_cast<runtime::Executable>(
       std::make_shared<HESealExecutable>(function, enable_performance_data,
                                          *this));
 }
 
 bool HESealBackend::is_supported(const Node& node) const {
-  return m_unsupported_op_name_list.find(node.description()) ==
-             m_unsupported_op_name_list.end() &&
+  return (is_client_op(node) ||
+          m_unsupported_op_name_list.find(node.description()) ==
+              m_unsupported_op_name_list.end()) &&
          is_supported_type(node.get_element_type());
 }
 
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <functional>
+#include <limits>
 #include <map>
 #include <memory>
 #include <string>
@@ -47,6 +48,7 @@
 #include "seal/he_seal_encryption_parameters.hpp"
 #include "seal/seal.h"
 #include "seal/seal_ciphertext_wrapper.hpp"
+#include "seal/seal_codec.hpp"
 #include "seal/seal_plaintext_wrapper.hpp"
 
 extern "C" void ngraph_register_he_seal_backend();
@@ -82,7 +84,10 @@ class HESealBackend : public runtime::Backend {
     throw ngraph_error("create_tensor unimplemented");
   }
 
-  /// \brief Compiles a function
+  /// \brief Compiles a function. If automatic encryption parameters are
+  /// enabled, chooses encryption parameters for the function and regenerates
+  /// the context and keys. In this case, tensors should be created after
+  /// compilation
   /// \brief param[in] function Function to compile
   /// \brief param[in] enable_performance_data TODO(fboemer): unused
   /// \returns An executable object
@@ -90,10 +95,26 @@ class HESealBackend : public runtime::Backend {
       std::shared_ptr<Function> function,
       bool enable_performance_data = false) override;
 
-  /// \brief Returns whether or not a given node is supported
+  /// \brief Returns whether or not a given node is supported. Ops evaluated
+  /// by the client are supported
   /// \param[in] node Node
   bool is_supported(const Node& node) const override;
 
+  /// \brief Returns whether or not a given node is evaluated by the client.
+  /// Client ops are set with the "client_ops" configuration, and must be
+  /// registered in the ClientOpRegistry
+  /// \param[in] node Node
+  bool is_client_op(const Node& node) const {
+    return m_enable_client &&
+           m_client_ops.find(node.description()) != m_client_ops.end();
+  }
+
+  /// \brief Returns the names of ops evaluated by the client, or no names if
+  /// the client is not enabled
+  std::unordered_set<std::string> client_ops() const {
+    return m_enable_client ? m_client_ops : std::unordered_set<std::string>{};
+  }
+
   /// \brief Sets a configuration for the backend
   /// \param[in] config Configuration map. It should contain entries in one of
   /// the following forms:
@@ -114,6 +135,22 @@ class HESealBackend : public runtime::Backend {
   ///     6) {"enable_gc": "True"/"False"}, which indicates whether or not the
   ///     client should use garbled circuits for secure function evaluation.
   ///     Should only be enabled if the client is enabled.
+  ///     7) {"encryption_parameters" : "auto"}, which chooses the encryption
+  ///     parameters automatically when compiling a function. The parameters
+  ///     are chosen from the multiplicative depth of the function, the
+  ///     "precision_bits" and "integer_bits" entries (defaulting to 24 and 6),
+  ///     and the security level and complex packing of the current encryption
+  ///     parameters. If "save_encryption_parameters" is set to a filename, the
+  ///     chosen parameters are saved as JSON to the file.
+  ///     8) {"codec" : "none"/"deflate"}, which sets the codec the server
+  ///     prefers for serializing ciphertexts and keys exchanged with the
+  ///     client. The codec is negotiated with the client, falling back to
+  ///     "none" if the client does not support it.
+  ///     9) {"max_levels" : "<integer>"}, which limits the number of levels
+  ///     encrypted tensors may consume. Should only be set if the client is
+  ///     enabled. Tensors which would exceed the limit are refreshed by the
+  ///     client, so "auto" encryption parameters need only support the limit.
+  ///     The executable also limits levels to those its parameters support.
   ///
   ///     Note, entries with the same tensor key should be comma-separated,
   ///     for instance: {tensor_name : "client_input,encrypt,packed"}
@@ -175,6 +212,14 @@ class HESealBackend : public runtime::Backend {
     return std::make_shared<SealCiphertextWrapper>();
   }
 
+  /// \brief Creates empty ciphertext which allocates from the given pool
+  /// \param[in] pool Memory pool used to allocate the ciphertext data
+  /// \returns Pointer to created ciphertext
+  static std::shared_ptr<SealCiphertextWrapper> create_empty_ciphertext(
+      const seal::MemoryPoolHandle& pool) {
+    return std::make_shared<SealCiphertextWrapper>(pool);
+  }
+
   /// \brief TODO(fboemer)
   void encrypt(std::shared_ptr<SealCiphertextWrapper>& output,
                const HEPlaintext& input, const element::Type& type,
@@ -230,6 +275,21 @@ class HESealBackend : public runtime::Backend {
   void update_encryption_parameters(
       const HESealEncryptionParameters& new_parms);
 
+  /// \brief Chooses and updates to the smallest encryption parameters which
+  /// support the given number of levels at the configured precision
+  /// \param[in] levels Number of rescales the parameters must support
+  void choose_encryption_parameters(size_t levels);
+
+  /// \brief Returns whether or not encryption parameters are chosen
+  /// automatically when compiling a function
+  bool auto_encryption_parameters() const {
+    return m_auto_encryption_parameters;
+  }
+
+  /// \brief Returns the maximum number of levels an encrypted tensor may
+  /// consume before it is refreshed by the client
+  size_t max_levels() const { return m_max_levels; }
+
   /// \brief Returns the CKKS encoder
   const std::shared_ptr<seal::CKKSEncoder> get_ckks_encoder() const {
     return m_ckks_encoder;
@@ -273,6 +333,10 @@ class HESealBackend : public runtime::Backend {
     return m_port;
   }
 
+  /// \brief Returns the path of the Unix domain socket the server listens
+  /// on instead of the port, or an empty string to use TCP
+  const std::string& socket_path() const { return m_socket_path; }
+
   /// \brief Returns whether or not the garbled circuit inputs should be masked
   /// for privacy
   bool mask_gc_inputs() const { return m_mask_gc_inputs; }
@@ -325,8 +389,28 @@ class HESealBackend : public runtime::Backend {
     }
   }
 
+  /// \brief Returns the codec the server prefers for serializing messages to
+  /// and from the client
+  pb::Codec codec() const { return m_codec; }
+
   bool& lazy_mod() { return m_lazy_mod; }
 
+  /// \brief Returns whether or not cipher tensors store their ciphertexts in
+  /// a contiguous slab
+  bool slab_storage() const { return m_slab_storage; }
+
+  /// \brief Returns whether or not cipher tensors store their ciphertexts in
+  /// a contiguous slab
+  bool& slab_storage() { return m_slab_storage; }
+
+  /// \brief Returns whether or not ciphertexts the client only decrypts are
+  /// switched to the lowest level before they are sent
+  bool mod_switch_outgoing() const { return m_mod_switch_outgoing; }
+
+  /// \brief Returns whether or not ciphertexts the client only decrypts are
+  /// switched to the lowest level before they are sent
+  bool& mod_switch_outgoing() { return m_mod_switch_outgoing; }
+
  private:
   bool m_enable_client{false};
   bool m_enable_garbled_circuit{false};
@@ -334,8 +418,22 @@ class HESealBackend : public runtime::Backend {
   bool m_mask_gc_outputs{false};
   size_t m_num_garbled_circuit_threads{1};
   size_t m_port{34000};
+  std::string m_socket_path;
+  std::unordered_set<std::string> m_client_ops;
+
+  bool m_auto_encryption_parameters{false};
+  size_t m_max_levels{std::numeric_limits<size_t>::max()};
+  int m_precision_bits{24};
+  int m_integer_bits{6};
+  std::string m_save_encryption_parameters_path;
+
+  pb::Codec m_codec{pb::CODEC_NONE};
 
   bool m_lazy_mod{string_to_bool(std::getenv("LAZY_MOD"), false)};
+  bool m_slab_storage{
+      string_to_bool(std::getenv("NGRAPH_HE_SLAB_STORAGE"), false)};
+  bool m_mod_switch_outgoing{
+      string_to_bool(std::getenv("NGRAPH_HE_MOD_SWITCH_OUTGOING"), false)};
 
   std::shared_ptr<seal::SecretKey> m_secret_key;
   std::shared_ptr<seal::PublicKey> m_public_key;
@@ -19,6 +19,7 @@
 #include <algorithm>
 #include <functional>
 #include <numeric>
+#include <thread>
 #include <unordered_set>
 
 #include "boost/asio.hpp"
@@ -26,6 +27,7 @@
 #include "logging/ngraph_he_log.hpp"
 #include "ngraph/log.hpp"
 #include "nlohmann/json.hpp"
+#include "seal/client_op_registry.hpp"
 #include "seal/kernel/bounded_relu_seal.hpp"
 #include "seal/kernel/max_pool_seal.hpp"
 #include "seal/kernel/relu_seal.hpp"
@@ -34,6 +36,7 @@
 #include "seal/seal_util.hpp"
 #include "tcp/tcp_client.hpp"
 #include "tcp/tcp_message.hpp"
+#include "tcp/tcp_transport.hpp"
 
 using json = nlohmann::json;
 
@@ -51,15 +54,31 @@ HESealClient::HESealClient(const std::string& hostname, const size_t port,
     NGRAPH_HE_LOG(1) << "Client input tensor: " << elem.first;
   }
 
-  boost::asio::io_context io_context;
-  boost::asio::ip::tcp::resolver resolver(io_context);
-  auto endpoints = resolver.resolve(hostname, std::to_string(port));
+  m_request_handlers = {
+      {"Parameter",
+       [this](pb::TCPMessage&& message, const CiphertextPayloads&) {
+         handle_inference_request(message);
+       }},
+      {"Relu",
+       [this](pb::TCPMessage&& message, const CiphertextPayloads& payloads) {
+         handle_relu_request(std::move(message), payloads);
+       }},
+      {"BoundedRelu",
+       [this](pb::TCPMessage&& message, const CiphertextPayloads& payloads) {
+         handle_bounded_relu_request(std::move(message), payloads);
+       }},
+      {"MaxPool",
+       [this](pb::TCPMessage&& message, const CiphertextPayloads& payloads) {
+         handle_max_pool_request(std::move(message), payloads);
+       }}};
+
+  m_endpoints = resolve_endpoints(m_io_context, hostname, port);
   auto client_callback = [this](const TCPMessage& message) {
     return handle_message(message);
   };
   m_tcp_client =
-      std::make_unique<TCPClient>(io_context, endpoints, client_callback);
-  io_context.run();
+      std::make_unique<TCPClient>(m_io_context, m_endpoints, client_callback);
+  m_io_context.run();
 }
 
 HESealClient::HESealClient(const std::string& hostname, const size_t port,
@@ -90,10 +109,13 @@ void HESealClient::set_seal_context() {
   }
   m_public_key = std::make_shared<seal::PublicKey>(m_keygen->public_key());
   m_secret_key = std::make_shared<seal::SecretKey>(m_keygen->secret_key());
-  m_encryptor = std::make_shared<seal::Encryptor>(m_context, *m_public_key);
+  // The secret key enables seeded symmetric encryption of client inputs
+  m_encryptor = std::make_shared<seal::Encryptor>(m_context, *m_public_key,
+                                                  *m_secret_key);
   m_decryptor = std::make_shared<seal::Decryptor>(m_context, *m_secret_key);
   m_evaluator = std::make_shared<seal::Evaluator>(m_context);
   m_ckks_encoder = std::make_shared<seal::CKKSEncoder>(m_context);
+  m_tcp_client->set_context(m_context);
 }
 
 void HESealClient::send_public_and_relin_keys() {
@@ -103,7 +125,7 @@ void HESealClient::send_public_and_relin_keys() {
 
   // Set public key
   std::stringstream pk_stream;
-  m_public_key->save(pk_stream);
+  m_public_key->save(pk_stream, compr_mode());
   pb::PublicKey public_key;
   public_key.set_public_key(pk_stream.str());
   *message.mutable_public_key() = public_key;
@@ -111,15 +133,47 @@ void HESealClient::send_public_and_relin_keys() {
   // Set relinearization keys
   if (m_context->using_keyswitching()) {
     std::stringstream evk_stream;
-    m_relin_keys->save(evk_stream);
+    m_relin_keys->save(evk_stream, compr_mode());
     pb::EvaluationKey eval_key;
     eval_key.set_eval_key(evk_stream.str());
     *message.mutable_eval_key() = eval_key;
   }
 
+  message.set_codec(m_codec);
+  message.set_num_connections(m_num_connections);
+
   write_message(TCPMessage(std::move(message)));
 }
 
+void HESealClient::open_stripe_connections() {
+  if (m_num_connections <= 1) {
+    return;
+  }
+  NGRAPH_HE_LOG(3) << "Client opening " << m_num_connections - 1
+                   << " additional connections";
+  // Messages from every connection are handled in a single order
+  for (size_t i = 1; i < m_num_connections; ++i) {
+    auto stripe_client = std::make_unique<TCPClient>(
+        m_io_context, m_endpoints, m_tcp_client->dispatcher());
+    stripe_client->set_context(m_context);
+    m_stripe_clients.emplace_back(std::move(stripe_client));
+  }
+}
+
+void HESealClient::write_striped_message(TCPMessage&& message) {
+  // Connections still being established are skipped, so the transfer never
+  // waits on them
+  std::vector<TCPClient*> clients{m_tcp_client.get()};
+  for (const auto& stripe_client : m_stripe_clients) {
+    if (stripe_client->connected()) {
+      clients.emplace_back(stripe_client.get());
+    }
+  }
+  TCPClient* client = clients[m_stripe_idx++ % clients.size()];
+  client->wait_for_write_queue(max_queued_input_messages);
+  client->write_message(std::move(message));
+}
+
 void HESealClient::handle_encryption_parameters_response(
     const pb::TCPMessage& message) {
   NGRAPH_HE_LOG(3) << "Client handling encryption parameters message";
@@ -135,8 +189,34 @@ void HESealClient::handle_encryption_parameters_response(
                    << enc_parms_str.size();
   m_encryption_params = HESealEncryptionParameters::load(param_stream);
 
+  m_codec = negotiate_codec(message.encryption_parameters());
+  NGRAPH_HE_LOG(3) << "Client using codec " << codec_name(m_codec);
+
   set_seal_context();
   send_public_and_relin_keys();
+  open_stripe_connections();
+  precompute_input_encryptions();
+}
+
+void HESealClient::precompute_input_encryptions() {
+  // Seeded symmetric encryption does not use encryptions of zero
+  if (m_seeded_encryption) {
+    return;
+  }
+  size_t num_ciphertexts = 0;
+  for (const auto& [name, config] : m_input_config) {
+    const auto& [input_config, input_data] = config;
+    if (input_config == "encrypt" && m_batch_size != 0) {
+      num_ciphertexts += input_data.size() / m_batch_size;
+    }
+  }
+  if (num_ciphertexts == 0) {
+    return;
+  }
+  size_t num_threads = std::max(1U, std::thread::hardware_concurrency());
+  m_zero_encryption_pool = std::make_shared<SealZeroEncryptionPool>(
+      m_context, *m_encryptor, m_context->first_parms_id(), num_ciphertexts,
+      num_threads);
 }
 
 void HESealClient::handle_inference_request(const pb::TCPMessage& message) {
@@ -198,30 +278,51 @@ void HESealClient::handle_inference_request(const pb::TCPMessage& message) {
   shape = HETensor::unpack_shape(shape, m_batch_size);
   auto element_type = element::f64;
 
+  // With seeded encryption, the input is encrypted as it is serialized, since
+  // encrypting into a seal::Ciphertext discards the seed
+  bool encrypt_symmetric = encrypt_tensor && m_seeded_encryption;
+
   auto he_tensor = HETensor(
       element_type, shape, pb_tensor.packed(),
-      m_encryption_params.complex_packing(), encrypt_tensor, *m_ckks_encoder,
-      m_context, *m_encryptor, *m_decryptor, m_encryption_params, pb_name);
+      m_encryption_params.complex_packing(),
+      encrypt_tensor && !encrypt_symmetric, *m_ckks_encoder, m_context,
+      *m_encryptor, *m_decryptor, m_encryption_params, pb_name);
 
   size_t num_bytes = parameter_size * sizeof(double) * m_batch_size;
+  if (encrypt_tensor && !encrypt_symmetric) {
+    he_tensor.set_zero_encryption_pool(m_zero_encryption_pool);
+  }
+
   NGRAPH_HE_LOG(3) << "Writing to tensor";
   he_tensor.write(input_data.data(), num_bytes);
 
-  NGRAPH_HE_LOG(3) << "Writing to pb tensors";
-  const auto& saved_pb_tensors = he_tensor.write_to_pb_tensors();
-  for (const auto& saved_pb_tensor : saved_pb_tensors) {
-    pb::TCPMessage inputs_msg;
-    inputs_msg.set_type(pb::TCPMessage_Type_REQUEST);
-    *inputs_msg.add_he_tensors() = saved_pb_tensor;
-
-    auto param_shape = inputs_msg.he_tensors(0).shape();
-    NGRAPH_HE_LOG(3) << "Client sending encrypted input with shape "
-                     << Shape{param_shape.begin(), param_shape.end()};
-    write_message(TCPMessage(std::move(inputs_msg)));
+  // Stop precomputing once the input is encrypted
+  if (m_zero_encryption_pool != nullptr) {
+    NGRAPH_HE_LOG(3) << "Client computed "
+                     << m_zero_encryption_pool->miss_count()
+                     << " input encryptions of zero on demand";
+    he_tensor.set_zero_encryption_pool(nullptr);
+    m_zero_encryption_pool = nullptr;
   }
+
+  // Each chunk of the input is queued as soon as it is encoded. Handlers run
+  // off the io thread, so may wait for the queue to drain. The server
+  // reassembles the chunks by offset, so they may arrive on any connection
+  NGRAPH_HE_LOG(3) << "Client sending encrypted input with shape "
+                   << he_tensor.get_shape();
+  he_tensor.write_to_pb_tensors(
+      [this](pb::HETensor&& pb_tensor, CiphertextPayloads&& payloads) {
+        pb::TCPMessage inputs_msg;
+        inputs_msg.set_type(pb::TCPMessage_Type_REQUEST);
+        *inputs_msg.add_he_tensors() = std::move(pb_tensor);
+        write_striped_message(
+            TCPMessage(std::move(inputs_msg), std::move(payloads)));
+      },
+      compr_mode(), encrypt_symmetric, true);
 }
 
-void HESealClient::handle_result(const pb::TCPMessage& message) {
+void HESealClient::handle_result(const pb::TCPMessage& message,
+                                 const CiphertextPayloads& payloads) {
   NGRAPH_HE_LOG(3) << "Client handling result";
 
   NGRAPH_CHECK(message.he_tensors_size() > 0,
@@ -229,38 +330,68 @@ void HESealClient::handle_result(const pb::TCPMessage& message) {
   NGRAPH_CHECK(message.he_tensors_size() == 1,
                "Client supports only results with one tensor");
 
-  const auto& pb_tensor = message.he_tensors(0);
+  size_t result_idx = 0;
+  size_t result_count = 1;
+  if (message.has_function()) {
+    const json js = json::parse(message.function().function());
+    result_idx = js.at("result_index");
+    result_count = js.at("result_count");
+  }
+  NGRAPH_CHECK(result_idx < result_count, "Result index ", result_idx,
+               " out of range ", result_count);
+  if (m_result_tensors.empty()) {
+    m_result_tensors.resize(result_count);
+    m_result_bytes.resize(result_count);
+  }
+  NGRAPH_CHECK(m_result_tensors.size() == result_count, "Expected ",
+               m_result_tensors.size(), " results, got ", result_count);
 
-  if (m_result_tensor == nullptr) {
-    m_result_tensor = HETensor::load_from_pb_tensor(
+  const auto& pb_tensor = message.he_tensors(0);
+  auto& result_tensor = m_result_tensors[result_idx];
+  if (result_tensor == nullptr) {
+    result_tensor = HETensor::load_from_pb_tensor(
         pb_tensor, *m_ckks_encoder, m_context, *m_encryptor, *m_decryptor,
-        m_encryption_params);
+        m_encryption_params, payloads);
   } else {
-    HETensor::load_from_pb_tensor(m_result_tensor, pb_tensor, m_context);
+    HETensor::load_from_pb_tensor(result_tensor, pb_tensor, m_context,
+                                  payloads);
   }
 
-  if (m_result_tensor->done_loading()) {
-    size_t data_size =
-        m_result_tensor->data().size() * m_result_tensor->get_batch_size();
-    m_results.resize(data_size);
-    const auto& type = m_result_tensor->get_element_type();
-    size_t num_bytes = data_size * type.size();
-    auto bytes = ngraph_malloc(num_bytes);
+  // Decrypt each chunk as it arrives, while later chunks are in flight
+  const auto& type = result_tensor->get_element_type();
+  auto& bytes = m_result_bytes[result_idx];
+  if (bytes.empty()) {
+    bytes.resize(result_tensor->data().size() *
+                 result_tensor->get_batch_size() * type.size());
+  }
+  result_tensor->read_range(bytes.data(), pb_tensor.offset(),
+                            pb_tensor.data_size());
 
-    m_result_tensor->read(bytes, num_bytes);
+  if (!result_tensor->done_loading()) {
+    return;
+  }
+  NGRAPH_HE_LOG(3) << "Client loaded result " << result_idx << " of "
+                   << result_count;
+  if (++m_results_loaded < result_count) {
+    return;
+  }
 
-    for (size_t i = 0; i < data_size; ++i) {
-      void* addr =
-          static_cast<void*>(static_cast<char*>(bytes) + i * type.size());
-      m_results[i] = type_to_double(addr, type);
+  for (size_t idx = 0; idx < result_count; ++idx) {
+    const auto& result_type = m_result_tensors[idx]->get_element_type();
+    const auto& result_bytes = m_result_bytes[idx];
+    for (size_t offset = 0; offset < result_bytes.size();
+         offset += result_type.size()) {
+      m_results.emplace_back(
+          type_to_double(result_bytes.data() + offset, result_type));
     }
-
-    ngraph_free(bytes);
-    close_connection();
   }
+  m_result_tensors.clear();
+  m_result_bytes.clear();
+  close_connection();
 }
 
-void HESealClient::handle_relu_request(pb::TCPMessage&& message) {
+void HESealClient::handle_relu_request(pb::TCPMessage&& message,
+                                       const CiphertextPayloads& payloads) {
   NGRAPH_HE_LOG(3) << "Client handling relu request";
 
   NGRAPH_CHECK(message.has_function(), "Proto message doesn't have function");
@@ -274,7 +405,7 @@ void HESealClient::handle_relu_request(pb::TCPMessage&& message) {
   pb::HETensor* pb_tensor = message.mutable_he_tensors(0);
   auto he_tensor = HETensor::load_from_pb_tensor(
       *pb_tensor, *m_ckks_encoder, m_context, *m_encryptor, *m_decryptor,
-      m_encryption_params);
+      m_encryption_params, payloads);
 
   const std::string& function = message.function().function();
   const json& js = json::parse(function);
@@ -301,16 +432,20 @@ void HESealClient::handle_relu_request(pb::TCPMessage&& message) {
     }
   }
 
-  const auto pb_output_tensors = he_tensor->write_to_pb_tensors();
+  std::vector<CiphertextPayloads> output_payloads;
+  const auto pb_output_tensors =
+      he_tensor->write_to_pb_tensors(compr_mode(), false, &output_payloads);
 
   NGRAPH_CHECK(pb_output_tensors.size() == 1,
                "Only support single-output tensors");
   *pb_tensor = pb_output_tensors[0];
 
-  write_message(TCPMessage(std::move(message)));
+  write_message(
+      TCPMessage(std::move(message), std::move(output_payloads[0])));
 }
 
-void HESealClient::handle_bounded_relu_request(pb::TCPMessage&& message) {
+void HESealClient::handle_bounded_relu_request(
+    pb::TCPMessage&& message, const CiphertextPayloads& payloads) {
   NGRAPH_HE_LOG(3) << "Client handling bounded relu request";
 
   NGRAPH_CHECK(message.has_function(), "Proto message doesn't have function");
@@ -328,7 +463,7 @@ void HESealClient::handle_bounded_relu_request(pb::TCPMessage&& message) {
   pb::HETensor* pb_tensor = message.mutable_he_tensors(0);
   auto he_tensor = HETensor::load_from_pb_tensor(
       *pb_tensor, *m_ckks_encoder, m_context, *m_encryptor, *m_decryptor,
-      m_encryption_params);
+      m_encryption_params, payloads);
 
   bool enable_gc = string_to_bool(std::string(js.at("enable_gc")));
 
@@ -352,15 +487,19 @@ void HESealClient::handle_bounded_relu_request(pb::TCPMessage&& message) {
           *m_decryptor, m_context);
     }
   }
-  const auto& pb_output_tensors = he_tensor->write_to_pb_tensors();
+  std::vector<CiphertextPayloads> output_payloads;
+  const auto& pb_output_tensors =
+      he_tensor->write_to_pb_tensors(compr_mode(), false, &output_payloads);
   NGRAPH_CHECK(pb_output_tensors.size() == 1,
                "Only support single-output tensors");
   *pb_tensor = pb_output_tensors[0];
 
-  write_message(TCPMessage(std::move(message)));
+  write_message(
+      TCPMessage(std::move(message), std::move(output_payloads[0])));
 }
 
-void HESealClient::handle_max_pool_request(pb::TCPMessage&& message) {
+void HESealClient::handle_max_pool_request(
+    pb::TCPMessage&& message, const CiphertextPayloads& payloads) {
   NGRAPH_HE_LOG(3) << "Client handling maxpool request";
 
   NGRAPH_CHECK(message.has_function(), "Proto message doesn't have function ");
@@ -369,39 +508,187 @@ void HESealClient::handle_max_pool_request(pb::TCPMessage&& message) {
   NGRAPH_CHECK(message.he_tensors_size() == 1,
                "Client supports only max pool requests with one tensor");
 
-  pb::HETensor* pb_tensor = message.mutable_he_tensors(0);
-  size_t cipher_count = pb_tensor->data_size();
+  const pb::HETensor& pb_tensor = message.he_tensors(0);
+  size_t cipher_count = pb_tensor.data_size();
 
-  std::vector<HEType> max_pool_ciphers(
-      cipher_count, HEType(HEPlaintext(m_batch_size), false));
-  std::vector<HEType> post_max_pool_ciphers(
-      {HEType(HEPlaintext(m_batch_size), false)});
+  // Window i maximizes over the next window_sizes[i] window indices
+  const pb::Function& function = message.function();
+  std::vector<std::vector<size_t>> max_lists;
+  if (function.window_sizes_size() == 0) {
+    max_lists.emplace_back(cipher_count);
+    std::iota(max_lists[0].begin(), max_lists[0].end(), 0);
+  } else {
+    max_lists.reserve(function.window_sizes_size());
+    size_t window_start = 0;
+    for (const uint64_t window_size : function.window_sizes()) {
+      NGRAPH_CHECK(window_start + window_size <=
+                       static_cast<size_t>(function.window_indices_size()),
+                   "MaxPool window exceeds window indices");
+      const auto begin = function.window_indices().begin() + window_start;
+      max_lists.emplace_back(begin, begin + window_size);
+      window_start += window_size;
+    }
+  }
+  for (const auto& max_list : max_lists) {
+    for (const size_t cipher_idx : max_list) {
+      NGRAPH_CHECK(cipher_idx < cipher_count, "MaxPool window index ",
+                   cipher_idx, " out of range ", cipher_count);
+    }
+  }
 
   auto he_tensor = HETensor::load_from_pb_tensor(
-      *pb_tensor, *m_ckks_encoder, m_context, *m_encryptor, *m_decryptor,
-      m_encryption_params);
-
-  // We currently just support max_pool with single output
-  auto post_max_he_tensor =
-      HETensor(he_tensor->get_element_type(), Shape{m_batch_size, 1},
-               he_tensor->is_packed(), complex_packing(), true, *m_ckks_encoder,
-               m_context, *m_encryptor, *m_decryptor, m_encryption_params);
-
-  max_pool_seal(he_tensor->data(), post_max_he_tensor.data(),
-                Shape{1, 1, cipher_count}, Shape{1, 1, 1}, Shape{cipher_count},
-                Strides{1}, Shape{0}, Shape{0}, m_context->first_parms_id(),
-                scale(), *m_ckks_encoder, *m_encryptor, *m_decryptor,
-                m_context);
+      pb_tensor, *m_ckks_encoder, m_context, *m_encryptor, *m_decryptor,
+      m_encryption_params, payloads);
+
+  auto post_max_he_tensor = HETensor(
+      he_tensor->get_element_type(), Shape{m_batch_size, max_lists.size()},
+      he_tensor->is_packed(), complex_packing(), true, *m_ckks_encoder,
+      m_context, *m_encryptor, *m_decryptor, m_encryption_params);
+
+  max_lists_seal(he_tensor->data(), post_max_he_tensor.data(), max_lists,
+                 m_context->first_parms_id(), scale(), *m_ckks_encoder,
+                 *m_encryptor, *m_decryptor, m_context);
+
+  // Relu and BoundedRelu are monotonic, so a fused activation is applied to
+  // the pooled maxima
+  const json js = json::parse(function.function());
+  if (js.find("activation") != js.end()) {
+    const json& activation = js.at("activation");
+    const std::string activation_name = activation.at("function");
+    NGRAPH_HE_LOG(3) << "Client applying fused " << activation_name;
+    NGRAPH_CHECK(activation_name == "Relu" || activation_name == "BoundedRelu",
+                 "Unsupported fused MaxPool activation ", activation_name);
+    bool bounded = activation_name == "BoundedRelu";
+    float bound = bounded ? activation.at("bound").get<float>() : 0;
+
+    auto& post_max_data = post_max_he_tensor.data();
+    size_t result_count = post_max_data.size();
+#pragma omp parallel for
+    for (size_t result_idx = 0; result_idx < result_count; ++result_idx) {
+      auto& he_type = post_max_data[result_idx];
+      if (bounded) {
+        scalar_bounded_relu_seal(he_type, he_type, bound,
+                                 m_context->first_parms_id(), scale(),
+                                 *m_ckks_encoder, *m_encryptor, *m_decryptor,
+                                 m_context);
+      } else {
+        scalar_relu_seal(he_type, he_type, m_context->first_parms_id(),
+                         scale(), *m_ckks_encoder, *m_encryptor, *m_decryptor,
+                         m_context);
+      }
+    }
+  }
 
   message.set_type(pb::TCPMessage_Type_RESPONSE);
   message.clear_he_tensors();
+  message.mutable_function()->clear_window_sizes();
+  message.mutable_function()->clear_window_indices();
 
-  const auto& pb_output_tensors = post_max_he_tensor.write_to_pb_tensors();
+  std::vector<CiphertextPayloads> output_payloads;
+  const auto& pb_output_tensors = post_max_he_tensor.write_to_pb_tensors(
+      compr_mode(), false, &output_payloads);
   NGRAPH_CHECK(pb_output_tensors.size() == 1,
                "Only support single-output tensors");
 
   *message.add_he_tensors() = pb_output_tensors[0];
-  write_message(TCPMessage(std::move(message)));
+  write_message(
+      TCPMessage(std::move(message), std::move(output_payloads[0])));
+}
+
+void HESealClient::handle_client_op_request(
+    pb::TCPMessage&& message, const CiphertextPayloads& payloads) {
+  NGRAPH_HE_LOG(3) << "Client handling client op request";
+
+  NGRAPH_CHECK(message.has_function(), "Proto message doesn't have function");
+  NGRAPH_CHECK(message.he_tensors_size() == 1,
+               "Client supports only client op requests with one tensor");
+
+  const json js = json::parse(message.function().function());
+  size_t arg_count = js.at("arg_count");
+  size_t arg_idx = js.at("arg_index");
+  NGRAPH_CHECK(arg_idx < arg_count, "Argument index ", arg_idx,
+               " out of range ", arg_count);
+
+  // Arguments arrive in chunks, reassembled by offset
+  m_client_op_args.resize(arg_count);
+  const auto& pb_tensor = message.he_tensors(0);
+  auto& arg = m_client_op_args[arg_idx];
+  if (arg == nullptr) {
+    arg = HETensor::load_from_pb_tensor(pb_tensor, *m_ckks_encoder, m_context,
+                                        *m_encryptor, *m_decryptor,
+                                        m_encryption_params, payloads);
+  } else {
+    HETensor::load_from_pb_tensor(arg, pb_tensor, m_context, payloads);
+  }
+  if (!std::all_of(m_client_op_args.begin(), m_client_op_args.end(),
+                   [](const auto& loaded_arg) {
+                     return loaded_arg != nullptr && loaded_arg->done_loading();
+                   })) {
+    return;
+  }
+  auto args = std::move(m_client_op_args);
+  m_client_op_args.clear();
+
+  const std::string name = js.at("function");
+  NGRAPH_HE_LOG(3) << "Client evaluating " << name;
+
+  std::vector<std::vector<HEPlaintext>> arg_values(args.size());
+  std::vector<Shape> arg_shapes;
+  for (size_t idx = 0; idx < args.size(); ++idx) {
+    const auto& arg_data = args[idx]->data();
+    arg_shapes.emplace_back(args[idx]->get_packed_shape());
+    arg_values[idx].resize(arg_data.size());
+#pragma omp parallel for
+    for (size_t value_idx = 0; value_idx < arg_data.size(); ++value_idx) {
+      const auto& he_type = arg_data[value_idx];
+      auto& value = arg_values[idx][value_idx];
+      if (he_type.is_plaintext()) {
+        value = he_type.get_plaintext();
+      } else {
+        decrypt(value, *he_type.get_ciphertext(), he_type.complex_packing(),
+                *m_decryptor, *m_ckks_encoder, m_context,
+                he_type.batch_size());
+      }
+      // Plaintexts with a single value apply to the whole batch
+      if (value.size() == 1) {
+        value.resize(he_type.batch_size(), value[0]);
+      }
+      value.resize(he_type.batch_size());
+    }
+  }
+
+  std::vector<uint64_t> out_shape = js.at("out_shape");
+  bool packed = js.at("packed");
+  const auto& element_type = args[0]->get_element_type();
+  HETensor out_tensor(element_type, Shape{out_shape.begin(), out_shape.end()},
+                      packed, complex_packing(), true, *m_ckks_encoder,
+                      m_context, *m_encryptor, *m_decryptor,
+                      m_encryption_params);
+
+  std::vector<HEPlaintext> out_values(out_tensor.data().size());
+  ClientOpRegistry::instance().kernel(name)(arg_values, arg_shapes,
+                                            out_values,
+                                            out_tensor.get_packed_shape(),
+                                            js.at("attributes"));
+
+  auto& out_data = out_tensor.data();
+#pragma omp parallel for
+  for (size_t out_idx = 0; out_idx < out_data.size(); ++out_idx) {
+    encrypt(out_data[out_idx].get_ciphertext(), out_values[out_idx],
+            m_context->first_parms_id(), element_type, scale(),
+            *m_ckks_encoder, *m_encryptor, complex_packing());
+  }
+
+  // The server reassembles the result from its chunks by offset
+  message.set_type(pb::TCPMessage_Type_RESPONSE);
+  message.clear_he_tensors();
+  out_tensor.write_to_pb_tensors(
+      [&](pb::HETensor&& pb_out_tensor, CiphertextPayloads&& out_payloads) {
+        pb::TCPMessage response{message};
+        *response.add_he_tensors() = std::move(pb_out_tensor);
+        write_message(TCPMessage(std::move(response), std::move(out_payloads)));
+      },
+      compr_mode(), false, true);
 }
 
 void HESealClient::handle_message(const TCPMessage& message) {
@@ -416,7 +703,7 @@ void HESealClient::handle_message(const TCPMessage& message) {
       if (pb_msg->has_encryption_parameters()) {
         handle_encryption_parameters_response(*pb_msg);
       } else if (pb_msg->he_tensors_size() > 0) {
-        handle_result(*pb_msg);
+        handle_result(*pb_msg, message.payloads());
       } else {
         NGRAPH_CHECK(false, "Unknown RESPONSE type");
       }
@@ -427,23 +714,15 @@ void HESealClient::handle_message(const TCPMessage& message) {
 
       const std::string& function = pb_msg->function().function();
       json js = json::parse(function);
-      auto name = js.at("function");
-
-      // TODO(fboemer): Move to any_of in message.proto
-      static std::unordered_set<std::string> s_known_names{
-          "Parameter", "Relu", "BoundedRelu", "MaxPool"};
-
-      NGRAPH_CHECK(s_known_names.find(name) != s_known_names.end(),
-                   "Unknown name ", name);
-
-      if (name == "Parameter") {
-        handle_inference_request(*pb_msg);
-      } else if (name == "Relu") {
-        handle_relu_request(std::move(*pb_msg));
-      } else if (name == "BoundedRelu") {
-        handle_bounded_relu_request(std::move(*pb_msg));
-      } else if (name == "MaxPool") {
-        handle_max_pool_request(std::move(*pb_msg));
+      const std::string name = js.at("function");
+
+      auto handler = m_request_handlers.find(name);
+      if (handler != m_request_handlers.end()) {
+        handler->second(std::move(*pb_msg), message.payloads());
+      } else {
+        NGRAPH_CHECK(ClientOpRegistry::instance().is_registered(name),
+                     "Unknown name ", name);
+        handle_client_op_request(std::move(*pb_msg), message.payloads());
       }
       break;
     }
@@ -465,6 +744,9 @@ std::vector<double> HESealClient::get_results() {
 void HESealClient::close_connection() {
   NGRAPH_HE_LOG(5) << "Closing connection";
   m_tcp_client->close();
+  for (const auto& stripe_client : m_stripe_clients) {
+    stripe_client->close();
+  }
 
   std::lock_guard<std::mutex> guard(m_is_done_mutex);
   m_is_done = true;
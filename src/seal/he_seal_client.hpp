@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <functional>
 #include <iostream>
 #include <memory>
 #include <mutex>
@@ -32,8 +34,11 @@
 #include "he_util.hpp"
 #include "seal/he_seal_encryption_parameters.hpp"
 #include "seal/seal.h"
+#include "seal/seal_codec.hpp"
+#include "seal/seal_zero_encryption_pool.hpp"
 #include "tcp/tcp_client.hpp"
 #include "tcp/tcp_message.hpp"
+#include "tcp/tcp_transport.hpp"
 
 namespace ngraph::runtime::aby {
 class ABYClientExecutor;
@@ -52,7 +57,8 @@ using HETensorConfigMap =
 class HESealClient {
  public:
   /// \brief Constructs a client object and connects to a server
-  /// \param[in] hostname Hostname of the server
+  /// \param[in] hostname Hostname of the server, or "unix:" followed by the
+  /// path of the server's Unix domain socket
   /// \param[in] port Port of the server
   /// \param[in] batch_size Batch size of the inference to perform
   /// \param[in] inputs Input data as a map from tensor name to pair of
@@ -91,19 +97,37 @@ class HESealClient {
 
   /// \brief Processes a request to perform ReLU function
   /// \param[in] message Message to process
-  void handle_relu_request(pb::TCPMessage&& message);
+  /// \param[in] payloads Raw ciphertext payloads of the message
+  void handle_relu_request(pb::TCPMessage&& message,
+                           const CiphertextPayloads& payloads);
 
   /// \brief Processes a request to perform MaxPool function
   /// \param[in] message Message to process
-  void handle_max_pool_request(pb::TCPMessage&& message);
+  /// \param[in] payloads Raw ciphertext payloads of the message
+  void handle_max_pool_request(pb::TCPMessage&& message,
+                               const CiphertextPayloads& payloads);
 
   /// \brief Processes a request to perform BoundedReLU function
   /// \param[in] message Message to process
-  void handle_bounded_relu_request(pb::TCPMessage&& message);
+  /// \param[in] payloads Raw ciphertext payloads of the message
+  void handle_bounded_relu_request(pb::TCPMessage&& message,
+                                   const CiphertextPayloads& payloads);
+
+  /// \brief Processes a chunk of an argument of an op in the
+  /// ClientOpRegistry. Once every argument is loaded, evaluates the op and
+  /// returns the encrypted result in chunks
+  /// \param[in] message Message to process
+  /// \param[in] payloads Raw ciphertext payloads of the message
+  void handle_client_op_request(pb::TCPMessage&& message,
+                                const CiphertextPayloads& payloads);
 
-  /// \brief Processes a message containing the result from the server
+  /// \brief Processes a message containing a chunk of a result from the
+  /// server. Each chunk is decrypted as it arrives, and the connection is
+  /// closed once every result is loaded
   /// \param[in] message Message to process
-  void handle_result(const pb::TCPMessage& message);
+  /// \param[in] payloads Raw ciphertext payloads of the message
+  void handle_result(const pb::TCPMessage& message,
+                     const CiphertextPayloads& payloads);
 
   /// \brief Processes a message containing the inference shape
   /// \param[in] message Message to process
@@ -112,6 +136,26 @@ class HESealClient {
   /// \brief Sends the public key and relinearization keys to the server
   void send_public_and_relin_keys();
 
+  /// \brief Opens the additional connections to the server across which
+  /// encrypted inputs are striped. Does nothing if only one connection is
+  /// used
+  void open_stripe_connections();
+
+  /// \brief Writes a tensor chunk to the server on the next connected
+  /// connection, in round-robin order. Blocks while too many messages are
+  /// queued on that connection
+  /// \param[in] message Message to write
+  void write_striped_message(TCPMessage&& message);
+
+  /// \brief Starts precomputing encryptions of zero for the encrypted client
+  /// input, while the server prepares the inference request. Does nothing if
+  /// the input uses seeded symmetric encryption
+  void precompute_input_encryptions();
+
+  /// \brief Maximum number of input messages queued to be written before
+  /// the client waits for the queue to drain
+  static constexpr size_t max_queued_input_messages = 4;
+
   /// \brief Writes a mesage to the server
   /// \param[in] message Message to write
   void write_message(ngraph::runtime::he::TCPMessage&& message) {
@@ -121,7 +165,8 @@ class HESealClient {
   /// \brief Returns whether or not the function is done evaluating
   bool is_done() { return m_is_done; }
 
-  /// \brief Returns decrypted results
+  /// \brief Returns decrypted results, concatenated in the order of the
+  /// function's results
   /// \warning Will lock until results are ready
   std::vector<double> get_results();
 
@@ -142,6 +187,19 @@ class HESealClient {
   }
 #endif
 
+  /// \brief Returns the codec negotiated with the server for serializing
+  /// ciphertexts and keys
+  pb::Codec codec() const { return m_codec; }
+
+  /// \brief Returns the SEAL compression mode of the negotiated codec
+  seal::compr_mode_type compr_mode() const {
+    return codec_to_compr_mode(m_codec);
+  }
+
+  /// \brief Returns whether or not encrypted inputs are uploaded using seeded
+  /// symmetric encryption, which roughly halves their size
+  bool seeded_encryption() const { return m_seeded_encryption; }
+
   /// \brief Returns the scale of the encryption parameters
   double scale() const { return m_encryption_params.scale(); }
 
@@ -167,7 +225,14 @@ class HESealClient {
  private:
   std::string m_hostname;  // Hostname of server to connect to
 
+  boost::asio::io_context m_io_context;
+  std::vector<stream_endpoint> m_endpoints;
   std::unique_ptr<TCPClient> m_tcp_client;
+  // Additional connections across which tensor chunks are striped
+  std::vector<std::unique_ptr<TCPClient>> m_stripe_clients;
+  size_t m_num_connections{static_cast<size_t>(std::max(
+      1, flag_to_int(std::getenv("NGRAPH_HE_NUM_CONNECTIONS"), 1)))};
+  size_t m_stripe_idx{0};
 
 #ifdef NGRAPH_HE_ABY_ENABLE
   std::unique_ptr<aby::ABYClientExecutor> m_aby_executor;
@@ -182,7 +247,12 @@ class HESealClient {
   std::shared_ptr<seal::Evaluator> m_evaluator;
   std::shared_ptr<seal::KeyGenerator> m_keygen;
   std::shared_ptr<seal::RelinKeys> m_relin_keys;
+  // Must be declared after m_encryptor, which it references
+  std::shared_ptr<SealZeroEncryptionPool> m_zero_encryption_pool;
   size_t m_batch_size;
+  pb::Codec m_codec{pb::CODEC_NONE};
+  bool m_seeded_encryption{
+      string_to_bool(std::getenv("NGRAPH_HE_SEEDED_ENCRYPTION"), true)};
 
   bool m_is_done{false};
   std::condition_variable m_is_done_cond;
@@ -190,9 +260,24 @@ class HESealClient {
 
   std::shared_ptr<HETensor> m_loaded_function_tensor;
 
+  /// \brief Processes a server request message
+  using RequestHandler =
+      std::function<void(pb::TCPMessage&&, const CiphertextPayloads&)>;
+
+  // Handlers of server requests with dedicated round-trips, by function name.
+  // Requests for ops in the ClientOpRegistry are handled by
+  // handle_client_op_request
+  std::unordered_map<std::string, RequestHandler> m_request_handlers;
+
+  // Arguments of the client op being loaded
+  std::vector<std::shared_ptr<HETensor>> m_client_op_args;
+
   // Function inputs and configuration
   HETensorConfigMap<double> m_input_config;
-  std::shared_ptr<HETensor> m_result_tensor;
+  // Function results, each decrypted into its bytes chunk by chunk
+  std::vector<std::shared_ptr<HETensor>> m_result_tensors;
+  std::vector<std::vector<char>> m_result_bytes;
+  size_t m_results_loaded{0};
   std::vector<double> m_results;  // Function outputs
 };
 }  // namespace ngraph::runtime::he
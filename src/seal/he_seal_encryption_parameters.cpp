@@ -16,9 +16,13 @@
 
 #include "seal/he_seal_encryption_parameters.hpp"
 
+#include <cmath>
 #include <exception>
+#include <numeric>
+#include <string>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "logging/ngraph_he_log.hpp"
 #include "ngraph/check.hpp"
@@ -121,6 +125,68 @@ double HESealEncryptionParameters::choose_scale(
   return sqrt(static_cast<double>(coeff_moduli.back().value() / 256.0));
 }
 
+HESealEncryptionParameters HESealEncryptionParameters::choose_parameters(
+    size_t levels, int precision_bits, int integer_bits,
+    std::uint64_t security_level, bool complex_packing) {
+  static constexpr int max_modulus_bits = 60;
+  const int first_modulus_bits = precision_bits + integer_bits;
+  NGRAPH_CHECK(precision_bits > 0 && integer_bits >= 0,
+               "Invalid precision bits ", precision_bits, " or integer bits ",
+               integer_bits);
+  NGRAPH_CHECK(first_modulus_bits <= max_modulus_bits, "Precision bits (",
+               precision_bits, ") + integer bits (", integer_bits,
+               ") must be at most ", max_modulus_bits);
+
+  std::vector<int> coeff_modulus_bits{first_modulus_bits};
+  if (levels > 0) {
+    coeff_modulus_bits.insert(coeff_modulus_bits.end(), levels,
+                              precision_bits);
+    // Special modulus for key switching
+    coeff_modulus_bits.push_back(first_modulus_bits);
+  }
+  const int total_bits = std::accumulate(coeff_modulus_bits.begin(),
+                                         coeff_modulus_bits.end(), 0);
+  const double scale = std::pow(2.0, precision_bits);
+
+  static const std::vector<std::uint64_t> poly_modulus_degrees{
+      1024, 2048, 4096, 8192, 16384, 32768};
+  for (const auto poly_modulus_degree : poly_modulus_degrees) {
+    if (security_level != 0 &&
+        total_bits > seal::CoeffModulus::MaxBitCount(
+                         poly_modulus_degree,
+                         seal_security_level(security_level))) {
+      continue;
+    }
+    try {
+      return HESealEncryptionParameters("HE_SEAL", poly_modulus_degree,
+                                        coeff_modulus_bits, security_level,
+                                        scale, complex_packing);
+    } catch (const std::exception& e) {
+      NGRAPH_HE_LOG(5) << "Poly modulus degree " << poly_modulus_degree
+                       << " is invalid: " << e.what();
+    }
+  }
+  throw ngraph_error("No valid encryption parameters support " +
+                     std::to_string(levels) + " levels with " +
+                     std::to_string(total_bits) +
+                     " coefficient modulus bits at security level " +
+                     std::to_string(security_level));
+}
+
+std::string HESealEncryptionParameters::to_json_string() const {
+  std::vector<int> coeff_modulus_bits;
+  for (const auto& modulus : m_seal_encryption_parameters.coeff_modulus()) {
+    coeff_modulus_bits.push_back(modulus.bit_count());
+  }
+  nlohmann::json js = {{"scheme_name", m_scheme_name},
+                       {"poly_modulus_degree", poly_modulus_degree()},
+                       {"security_level", m_security_level},
+                       {"coeff_modulus", coeff_modulus_bits},
+                       {"scale", m_scale},
+                       {"complex_packing", m_complex_packing}};
+  return js.dump(2);
+}
+
 bool HESealEncryptionParameters::operator==(
     const HESealEncryptionParameters& other) const {
 #pragma clang diagnostic push
@@ -103,6 +103,27 @@ class HESealEncryptionParameters {
   static double choose_scale(
       const std::vector<seal::SmallModulus>& coeff_moduli);
 
+  /// \brief Chooses the smallest CKKS encryption parameters which support the
+  /// given number of rescales at the given precision and security level.
+  /// The coefficient modulus consists of a first modulus of
+  /// precision_bits + integer_bits bits, one modulus of precision_bits bits per
+  /// level, and a special modulus for key switching.
+  /// \param[in] levels Number of rescales the parameters must support
+  /// \param[in] precision_bits Bits of precision of the fractional part of
+  /// values. The scale is chosen as 2^precision_bits
+  /// \param[in] integer_bits Bits needed to represent the integer part of
+  /// values
+  /// \param[in] security_level Bits of security. 0 indicates no security
+  /// \param[in] complex_packing Whether or not to use complex packing
+  /// \throws ngraph_error if no valid parameters exist
+  static HESealEncryptionParameters choose_parameters(
+      size_t levels, int precision_bits, int integer_bits,
+      std::uint64_t security_level, bool complex_packing);
+
+  /// \brief Returns a JSON string describing the encryption parameters, in
+  /// the format read by parse_config_or_use_default
+  std::string to_json_string() const;
+
   /// \brief Saves encryption parameters to a stream
   void save(std::ostream& stream) const;
 
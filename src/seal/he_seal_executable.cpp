@@ -16,6 +16,7 @@
 
 #include "seal/he_seal_executable.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <functional>
 #include <limits>
@@ -43,11 +44,15 @@
 #include "ngraph/util.hpp"
 #include "nlohmann/json.hpp"
 #include "op/bounded_relu.hpp"
+#include "pass/defer_relinearization.hpp"
+#include "pass/fuse_client_ops.hpp"
 #include "pass/he_fusion.hpp"
 #include "pass/he_liveness.hpp"
+#include "pass/level_accounting.hpp"
 #include "pass/propagate_he_annotations.hpp"
 #include "pass/supported_ops.hpp"
 #include "protos/message.pb.h"
+#include "seal/client_op_registry.hpp"
 #include "seal/he_seal_backend.hpp"
 #include "seal/kernel/add_seal.hpp"
 #include "seal/kernel/avg_pool_seal.hpp"
@@ -68,6 +73,7 @@
 #include "seal/kernel/negate_seal.hpp"
 #include "seal/kernel/pad_seal.hpp"
 #include "seal/kernel/power_seal.hpp"
+#include "seal/kernel/relinearize_seal.hpp"
 #include "seal/kernel/relu_seal.hpp"
 #include "seal/kernel/rescale_seal.hpp"
 #include "seal/kernel/reshape_seal.hpp"
@@ -96,6 +102,22 @@ HESealExecutable::HESealExecutable(const std::shared_ptr<Function>& function,
   m_port = he_seal_backend.port();
   m_function = function;
 
+  m_client_result_handlers = {
+      {"Relu",
+       [this](const pb::TCPMessage& pb_message,
+              const CiphertextPayloads& payloads) {
+         handle_relu_result(pb_message, payloads);
+       }},
+      {"BoundedRelu",
+       [this](const pb::TCPMessage& pb_message,
+              const CiphertextPayloads& payloads) {
+         handle_bounded_relu_result(pb_message, payloads);
+       }},
+      {"MaxPool", [this](const pb::TCPMessage& pb_message,
+                         const CiphertextPayloads& payloads) {
+         handle_max_pool_result(pb_message, payloads);
+       }}};
+
   if (!m_context->using_keyswitching()) {
     m_client_eval_key_set = true;
   }
@@ -179,6 +201,7 @@ HESealExecutable::~HESealExecutable() noexcept {
     }
     m_acceptor = nullptr;
     m_session = nullptr;
+    m_stripe_sessions.clear();
   }
 }
 
@@ -186,9 +209,29 @@ void HESealExecutable::update_he_op_annotations() {
   NGRAPH_HE_LOG(3) << "Upadting HE op annotations";
   ngraph::pass::Manager pass_manager_he;
   pass_manager_he.register_pass<pass::PropagateHEAnnotations>();
+  pass_manager_he.register_pass<pass::DeferRelinearization>();
+  pass_manager_he.register_pass<pass::FuseClientOps>(enable_garbled_circuits());
+  size_t levels_available = m_context->first_context_data()->chain_index();
+  // With a client, tensors are refreshed before they run out of levels
+  size_t max_level = std::numeric_limits<size_t>::max();
+  if (enable_client()) {
+    max_level = std::min(levels_available, m_he_seal_backend.max_levels());
+  }
+  auto level_accounting = pass_manager_he.register_pass<pass::LevelAccounting>(
+      max_level, m_he_seal_backend.client_ops());
   pass_manager_he.run_passes(m_function);
   m_is_compiled = true;
 
+  m_levels_consumed = level_accounting->levels_consumed();
+  NGRAPH_HE_LOG(1) << "Function consumes " << m_levels_consumed << " of "
+                   << levels_available << " available levels with "
+                   << level_accounting->refresh_count() << " refreshes";
+  if (m_levels_consumed > levels_available) {
+    NGRAPH_WARN << "Function consumes " << m_levels_consumed
+                << " levels, but encryption parameters only support "
+                << levels_available << " levels";
+  }
+
   m_nodes.clear();
   for (auto node : m_function->get_ordered_ops()) {
     m_nodes.push_back(node);
@@ -237,7 +280,7 @@ OP_TYPEID HESealExecutable::get_typeid(const NodeTypeInfo& type_info) {
 }
 
 void HESealExecutable::check_client_supports_function() {
-  // Check if single parameter is from client
+  // Check if any parameter is from client
   size_t from_client_count = 0;
   for (const auto& param : get_parameters()) {
     if (HEOpAnnotations::from_client(*param)) {
@@ -245,9 +288,6 @@ void HESealExecutable::check_client_supports_function() {
       NGRAPH_HE_LOG(5) << "Parameter " << param->get_name() << " from client";
     }
   }
-  NGRAPH_CHECK(get_results().size() == 1,
-               "HESealExecutable only supports output size 1 (got ",
-               get_results().size(), ")");
   NGRAPH_CHECK(from_client_count > 0, "Expected > 0 parameters from client");
 }
 
@@ -273,6 +313,9 @@ bool HESealExecutable::server_setup() {
 
     pb::EncryptionParameters pb_params;
     *pb_params.mutable_encryption_parameters() = param_stream.str();
+    for (const auto codec : offered_codecs(m_he_seal_backend.codec())) {
+      pb_params.add_codecs(codec);
+    }
 
     pb::TCPMessage pb_message;
     *pb_message.mutable_encryption_parameters() = pb_params;
@@ -305,11 +348,12 @@ void HESealExecutable::accept_connection() {
 
   m_acceptor->async_accept(
       [this, server_callback](boost::system::error_code ec,
-                              boost::asio::ip::tcp::socket socket) {
+                              stream_socket socket) {
         if (!ec) {
           NGRAPH_HE_LOG(1) << "Connection accepted";
           m_session =
               std::make_shared<TCPSession>(std::move(socket), server_callback);
+          m_session->set_context(m_context);
           m_session->start();
           NGRAPH_HE_LOG(1) << "Session started";
 
@@ -323,14 +367,33 @@ void HESealExecutable::accept_connection() {
       });
 }
 
+void HESealExecutable::accept_stripe_connections(size_t count) {
+  if (count == 0) {
+    return;
+  }
+  m_acceptor->async_accept([this, count](boost::system::error_code ec,
+                                         stream_socket socket) {
+    if (!ec) {
+      NGRAPH_HE_LOG(1) << "Stripe connection accepted";
+      // Messages from every connection are handled in a single order
+      auto session = std::make_shared<TCPSession>(std::move(socket),
+                                                  m_session->dispatcher());
+      session->set_context(m_context);
+      session->start();
+      {
+        std::lock_guard<std::mutex> guard(m_stripe_sessions_mutex);
+        m_stripe_sessions.emplace_back(std::move(session));
+      }
+      accept_stripe_connections(count - 1);
+    } else if (ec != boost::asio::error::operation_aborted) {
+      NGRAPH_ERR << "error accepting stripe connection " << ec.message();
+    }
+  });
+}
+
 void HESealExecutable::start_server() {
-  boost::asio::ip::tcp::resolver resolver(m_io_context);
-  boost::asio::ip::tcp::endpoint server_endpoints(boost::asio::ip::tcp::v4(),
-                                                  m_port);
-  m_acceptor = std::make_unique<boost::asio::ip::tcp::acceptor>(
-      m_io_context, server_endpoints);
-  boost::asio::socket_base::reuse_address option(true);
-  m_acceptor->set_option(option);
+  m_acceptor = open_acceptor(m_io_context, m_he_seal_backend.socket_path(),
+                             m_port);
 
   accept_connection();
   m_message_handling_thread = std::thread([this]() {
@@ -412,7 +475,8 @@ void HESealExecutable::send_inference_shape() {
   m_session->write_message(TCPMessage(std::move(pb_message)));
 }
 
-void HESealExecutable::handle_relu_result(const pb::TCPMessage& pb_message) {
+void HESealExecutable::handle_relu_result(const pb::TCPMessage& pb_message,
+                                          const CiphertextPayloads& payloads) {
   NGRAPH_HE_LOG(3) << "Server handling relu result";
   std::lock_guard<std::mutex> guard(m_relu_mutex);
 
@@ -425,7 +489,7 @@ void HESealExecutable::handle_relu_result(const pb::TCPMessage& pb_message) {
       pb_tensor, *m_he_seal_backend.get_ckks_encoder(),
       m_he_seal_backend.get_context(), *m_he_seal_backend.get_encryptor(),
       *m_he_seal_backend.get_decryptor(),
-      m_he_seal_backend.get_encryption_parameters());
+      m_he_seal_backend.get_encryption_parameters(), payloads);
 
   size_t result_count = pb_tensor.data_size();
   for (size_t result_idx = 0; result_idx < result_count; ++result_idx) {
@@ -440,17 +504,26 @@ void HESealExecutable::handle_relu_result(const pb::TCPMessage& pb_message) {
   }
 #endif
 
+  // Each request is answered by a single response, in order
+  m_relu_batcher.finish_batch();
+  const auto& metrics = m_relu_batcher.metrics().back();
+  NGRAPH_HE_LOG(4) << "Relu batch of " << metrics.element_count
+                   << " ciphertexts (" << metrics.byte_count
+                   << " bytes) took " << metrics.latency.count()
+                   << " us, delivering " << metrics.delivery_rate
+                   << " bytes/s";
+
   m_relu_done_count += result_count;
   m_relu_cond.notify_all();
 }
 
 void HESealExecutable::handle_bounded_relu_result(
-    const pb::TCPMessage& pb_message) {
-  handle_relu_result(pb_message);
+    const pb::TCPMessage& pb_message, const CiphertextPayloads& payloads) {
+  handle_relu_result(pb_message, payloads);
 }
 
 void HESealExecutable::handle_max_pool_result(
-    const pb::TCPMessage& pb_message) {
+    const pb::TCPMessage& pb_message, const CiphertextPayloads& payloads) {
   std::lock_guard<std::mutex> guard(m_max_pool_mutex);
 
   NGRAPH_CHECK(pb_message.he_tensors_size() == 1,
@@ -460,18 +533,50 @@ void HESealExecutable::handle_max_pool_result(
   const auto& pb_tensor = pb_message.he_tensors(0);
   size_t result_count = pb_tensor.data_size();
 
-  NGRAPH_CHECK(result_count == 1, "Maxpool only supports result_count 1, got ",
-               result_count);
+  NGRAPH_CHECK(
+      m_max_pool_data.size() + result_count <= m_max_pool_window_count,
+      "Received more MaxPool results than windows");
 
   auto he_tensor = HETensor::load_from_pb_tensor(
       pb_tensor, *m_he_seal_backend.get_ckks_encoder(),
       m_he_seal_backend.get_context(), *m_he_seal_backend.get_encryptor(),
       *m_he_seal_backend.get_decryptor(),
-      m_he_seal_backend.get_encryption_parameters());
+      m_he_seal_backend.get_encryption_parameters(), payloads);
+
+  // Each request is answered by a single response, in order
+  for (size_t result_idx = 0; result_idx < result_count; ++result_idx) {
+    m_max_pool_data.emplace_back(he_tensor->data(result_idx));
+  }
+  if (m_max_pool_data.size() == m_max_pool_window_count) {
+    m_max_pool_done = true;
+    m_max_pool_cond.notify_all();
+  }
+}
+
+void HESealExecutable::handle_client_op_result(
+    const pb::TCPMessage& pb_message, const CiphertextPayloads& payloads) {
+  NGRAPH_HE_LOG(3) << "Server handling client op result";
+  std::lock_guard<std::mutex> guard(m_client_op_mutex);
+
+  NGRAPH_CHECK(pb_message.he_tensors_size() == 1,
+               "Can only handle one tensor at a time, got ",
+               pb_message.he_tensors_size());
+
+  const auto& pb_tensor = pb_message.he_tensors(0);
+  if (m_client_op_result == nullptr) {
+    m_client_op_result = HETensor::load_from_pb_tensor(
+        pb_tensor, *m_he_seal_backend.get_ckks_encoder(),
+        m_he_seal_backend.get_context(), *m_he_seal_backend.get_encryptor(),
+        *m_he_seal_backend.get_decryptor(),
+        m_he_seal_backend.get_encryption_parameters(), payloads);
+  } else {
+    HETensor::load_from_pb_tensor(m_client_op_result, pb_tensor,
+                                  m_he_seal_backend.get_context(), payloads);
+  }
 
-  m_max_pool_data.emplace_back(he_tensor->data(0));
-  m_max_pool_done = true;
-  m_max_pool_cond.notify_all();
+  if (m_client_op_result->done_loading()) {
+    m_client_op_cond.notify_all();
+  }
 }
 
 void HESealExecutable::handle_message(const TCPMessage& message) {
@@ -483,6 +588,19 @@ void HESealExecutable::handle_message(const TCPMessage& message) {
   switch (pb_message->type()) {
     case pb::TCPMessage_Type_RESPONSE: {
       if (pb_message->has_public_key()) {
+        NGRAPH_CHECK(codec_supported(pb_message->codec()),
+                     "Client chose unsupported codec ",
+                     codec_name(pb_message->codec()));
+        m_codec = pb_message->codec();
+        NGRAPH_HE_LOG(3) << "Server using codec " << codec_name(m_codec);
+        if (pb_message->num_connections() > 1) {
+          size_t stripe_count = pb_message->num_connections() - 1;
+          NGRAPH_HE_LOG(3) << "Server accepting " << stripe_count
+                           << " additional connections";
+          boost::asio::post(m_io_context, [this, stripe_count]() {
+            accept_stripe_connections(stripe_count);
+          });
+        }
         load_public_key(*pb_message);
       }
       if (pb_message->has_eval_key()) {
@@ -497,27 +615,22 @@ void HESealExecutable::handle_message(const TCPMessage& message) {
         const std::string& function = pb_message->function().function();
         json js = json::parse(function);
 
-        auto name = js.at("function");
+        const std::string name = js.at("function");
 
-        static std::unordered_set<std::string> known_function_names{
-            "Relu", "BoundedRelu", "MaxPool"};
-        NGRAPH_CHECK(
-            known_function_names.find(name) != known_function_names.end(),
-            "Unknown function name ", name);
-
-        if (name == "Relu") {
-          handle_relu_result(*pb_message);
-        } else if (name == "BoundedRelu") {
-          handle_bounded_relu_result(*pb_message);
-        } else if (name == "MaxPool") {
-          handle_max_pool_result(*pb_message);
+        auto handler = m_client_result_handlers.find(name);
+        if (handler != m_client_result_handlers.end()) {
+          handler->second(*pb_message, message.payloads());
+        } else {
+          NGRAPH_CHECK(ClientOpRegistry::instance().is_registered(name),
+                       "Unknown function name ", name);
+          handle_client_op_result(*pb_message, message.payloads());
         }
       }
       break;
     }
     case pb::TCPMessage_Type_REQUEST: {
       if (pb_message->he_tensors_size() > 0) {
-        handle_client_ciphers(*pb_message);
+        handle_client_ciphers(*pb_message, message.payloads());
       }
       break;
     }
@@ -528,7 +641,8 @@ void HESealExecutable::handle_message(const TCPMessage& message) {
 #pragma clang diagnostic pop
 }
 
-void HESealExecutable::handle_client_ciphers(const pb::TCPMessage& pb_message) {
+void HESealExecutable::handle_client_ciphers(
+    const pb::TCPMessage& pb_message, const CiphertextPayloads& payloads) {
   NGRAPH_HE_LOG(3) << "Handling client tensors";
 
   NGRAPH_CHECK(pb_message.he_tensors_size() > 0,
@@ -582,11 +696,11 @@ void HESealExecutable::handle_client_ciphers(const pb::TCPMessage& pb_message) {
         pb_tensor, *m_he_seal_backend.get_ckks_encoder(),
         m_he_seal_backend.get_context(), *m_he_seal_backend.get_encryptor(),
         *m_he_seal_backend.get_decryptor(),
-        m_he_seal_backend.get_encryption_parameters());
+        m_he_seal_backend.get_encryption_parameters(), payloads);
     m_client_inputs[param_idx.value()] = he_tensor;
   } else {
     HETensor::load_from_pb_tensor(m_client_inputs[param_idx.value()], pb_tensor,
-                                  m_he_seal_backend.get_context());
+                                  m_he_seal_backend.get_context(), payloads);
   }
 
   auto done_loading = [&]() {
@@ -680,6 +794,10 @@ bool HESealExecutable::call(
 
       NGRAPH_HE_LOG(5) << "Parameter " << param->get_name()
                        << " has annotation " << *current_annotation;
+      // Ensure level accounting includes encrypted server inputs
+      if (he_input->any_encrypted_data()) {
+        current_annotation->set_encrypted(true);
+      }
       if (!he_input->any_encrypted_data()) {
         if (current_annotation->packed()) {
           he_input->pack();
@@ -714,6 +832,13 @@ bool HESealExecutable::call(
             HEOpAnnotations::he_op_annotation(*param)->packed(),
         "Mismatch between tensor input and annotation (", he_input->is_packed(),
         " != ", HEOpAnnotations::he_op_annotation(*param)->packed(), ")");
+    // Op annotations and intermediate tensors only support packing along
+    // the batch axis
+    NGRAPH_CHECK(!he_input->is_packed() ||
+                     he_input->get_pack_axes() == AxisSet{0},
+                 "Parameter ", param->get_name(),
+                 " must be packed along axis 0, got pack axes ",
+                 he_input->get_pack_axes());
     if (he_input->is_packed()) {
       set_batch_size(he_input->get_batch_size());
     }
@@ -727,7 +852,12 @@ bool HESealExecutable::call(
   std::vector<std::shared_ptr<HETensor>> he_outputs;
   he_outputs.reserve(outputs.size());
   for (auto& tensor : outputs) {
-    he_outputs.push_back(std::static_pointer_cast<HETensor>(tensor));
+    auto he_output = std::static_pointer_cast<HETensor>(tensor);
+    NGRAPH_CHECK(!he_output->is_packed() ||
+                     he_output->get_pack_axes() == AxisSet{0},
+                 "Output must be packed along axis 0, got pack axes ",
+                 he_output->get_pack_axes());
+    he_outputs.push_back(he_output);
   }
 
   NGRAPH_HE_LOG(3) << "Mapping function parameters to HETensor";
@@ -800,12 +930,6 @@ bool HESealExecutable::call(
       op_inputs.push_back(tensor_map.at(tensor));
     }
 
-    if (enable_client() && op->is_output()) {
-      // Client outputs don't have decryption performed, so skip result op
-      NGRAPH_HE_LOG(3) << "Setting client outputs";
-      m_client_outputs = op_inputs;
-    }
-
     // get op outputs from map or create
     std::vector<std::shared_ptr<HETensor>> op_outputs;
     for (size_t i = 0; i < op->get_output_size(); ++i) {
@@ -854,8 +978,27 @@ bool HESealExecutable::call(
       base_type = op->get_inputs().at(0).get_tensor().get_element_type();
     }
 
+    size_t pool_bytes_before = m_memory_pools.alloc_byte_count();
     generate_calls(base_type, *op.get(), op_outputs, op_inputs);
+    if (enable_client() && HEOpAnnotations::refresh(*op)) {
+      for (size_t i = 0; i < op_outputs.size(); ++i) {
+        if (op_outputs[i]->any_encrypted_data()) {
+          handle_server_refresh_op(op_outputs[i], op->get_output_shape(i),
+                                   *op);
+        }
+      }
+    }
+    // Client outputs don't have decryption performed, so are sent as is
+    if (enable_client() && op->is_output()) {
+      auto result = std::static_pointer_cast<op::Result>(op);
+      const auto& results = get_results();
+      size_t result_idx = static_cast<size_t>(
+          std::find(results.begin(), results.end(), result) - results.begin());
+      send_client_result(result_idx, *op_inputs[0]);
+    }
     m_timer_map[op].stop();
+    size_t pool_bytes = m_memory_pools.alloc_byte_count() - pool_bytes_before;
+    m_pool_alloc_byte_counts[op] += pool_bytes;
 
     // delete any obsolete tensors
     for (const descriptor::Tensor* t : op->liveness_free_list) {
@@ -877,6 +1020,9 @@ bool HESealExecutable::call(
       NGRAPH_HE_LOG(3) << "\033[1;31m" << op->get_name() << " took "
                        << m_timer_map[op].get_milliseconds() << "ms"
                        << "\033[0m";
+      NGRAPH_HE_LOG(3) << op->get_name() << " allocated " << pool_bytes
+                       << " bytes from " << m_memory_pools.size()
+                       << " thread memory pools";
     }
   }
   size_t total_time = 0;
@@ -886,38 +1032,88 @@ bool HESealExecutable::call(
   if (verbose_op("total")) {
     NGRAPH_HE_LOG(3) << "\033[1;32m"
                      << "Total time " << total_time << " (ms) \033[0m";
+    NGRAPH_HE_LOG(3) << "Thread memory pools hold "
+                     << m_memory_pools.alloc_byte_count() << " bytes";
   }
 
-  // Send outputs to client.
+  // Outputs are sent to the client as they are computed
   if (enable_client()) {
-    send_client_results();
+    finish_client_results();
   }
   return true;
 }
 
-void HESealExecutable::send_client_results() {
-  NGRAPH_HE_LOG(3) << "Sending results to client";
-  NGRAPH_CHECK(m_client_outputs.size() == 1,
-               "HESealExecutable only supports output size 1 (got ",
-               get_results().size(), "");
+void HESealExecutable::send_client_result(size_t result_idx,
+                                          const HETensor& tensor) {
+  NGRAPH_HE_LOG(3) << "Server sending result " << result_idx
+                   << " with shape " << tensor.get_shape();
+
+  HETensor result_tensor(tensor.get_element_type(), tensor.get_shape(),
+                         tensor.get_pack_axes(), complex_packing(), true,
+                         m_he_seal_backend, tensor.get_name());
+  result_tensor.data() = tensor.data();
+  // The client only decrypts the results. Switching a copy leaves the
+  // ciphertexts of the remaining ops untouched
+  if (m_he_seal_backend.mod_switch_outgoing()) {
+    mod_switch_to_lowest(result_tensor.data(), m_he_seal_backend);
+  }
 
-  auto pb_tensors = m_client_outputs[0]->write_to_pb_tensors();
+  json js = {{"function", "Result"},
+             {"result_index", result_idx},
+             {"result_count", get_results().size()}};
+  pb::TCPMessage result_msg;
+  result_msg.set_type(pb::TCPMessage_Type_RESPONSE);
+  pb::Function f;
+  f.set_function(js.dump());
+  *result_msg.mutable_function() = f;
 
-  for (const auto& pb_tensor : pb_tensors) {
-    pb::TCPMessage result_msg;
-    result_msg.set_type(pb::TCPMessage_Type_RESPONSE);
-    *result_msg.add_he_tensors() = pb_tensor;
+  // The client reassembles the result by offset, so it is striped
+  write_tensor(result_msg, result_tensor, true, nullptr, true);
+}
+
+void HESealExecutable::finish_client_results() {
+  // Wait until messages are written
+  for (const auto& session : sessions(true)) {
+    session->wait_for_write_queue(1);
+  }
+  // Stop awaiting stripe connections the client never completed, so the io
+  // thread finishes once the client disconnects
+  boost::asio::post(m_io_context, [this]() { m_acceptor->cancel(); });
+}
 
-    auto result_shape = result_msg.he_tensors(0).shape();
-    NGRAPH_HE_LOG(3) << "Server sending result with shape "
-                     << Shape{result_shape.begin(), result_shape.end()};
-    m_session->write_message(TCPMessage(std::move(result_msg)));
+std::vector<std::shared_ptr<TCPSession>> HESealExecutable::sessions(
+    bool stripe) {
+  std::vector<std::shared_ptr<TCPSession>> sessions{m_session};
+  if (stripe) {
+    std::lock_guard<std::mutex> guard(m_stripe_sessions_mutex);
+    sessions.insert(sessions.end(), m_stripe_sessions.begin(),
+                    m_stripe_sessions.end());
   }
+  return sessions;
+}
 
-  // Wait until message is written
-  std::unique_lock<std::mutex> mlock(m_result_mutex);
-  std::condition_variable& writing_cond = m_session->is_writing_cond();
-  writing_cond.wait(mlock, [this] { return !m_session->is_writing(); });
+void HESealExecutable::write_tensor(const pb::TCPMessage& message,
+                                    const HETensor& tensor,
+                                    bool raw_ciphertexts,
+                                    const std::function<void()>& on_write,
+                                    bool stripe) {
+  auto write_sessions = sessions(stripe);
+  size_t session_idx = 0;
+  tensor.write_to_pb_tensors(
+      [&](pb::HETensor&& pb_tensor, CiphertextPayloads&& payloads) {
+        pb::TCPMessage pb_message{message};
+        *pb_message.add_he_tensors() = std::move(pb_tensor);
+        const auto& session =
+            write_sessions[session_idx++ % write_sessions.size()];
+        // Bound the number of encoded chunks waiting on each socket
+        session->wait_for_write_queue(max_queued_tensor_messages);
+        session->write_message(
+            TCPMessage(std::move(pb_message), std::move(payloads)));
+        if (on_write) {
+          on_write();
+        }
+      },
+      codec_to_compr_mode(m_codec), false, raw_ciphertexts);
 }
 
 void HESealExecutable::generate_calls(
@@ -925,6 +1121,17 @@ void HESealExecutable::generate_calls(
     const std::vector<std::shared_ptr<HETensor>>& out,
     const std::vector<std::shared_ptr<HETensor>>& args) {
   bool verbose = verbose_op(&node);
+  bool defer_relinearization = HEOpAnnotations::defer_relinearization(node);
+  bool rescale = HEOpAnnotations::rescale(node);
+
+  // Ops with only plaintext arguments are cheaper to evaluate on the server
+  if (m_he_seal_backend.is_client_op(node) &&
+      std::any_of(args.begin(), args.end(), [](const auto& arg) {
+        return arg->any_encrypted_data();
+      })) {
+    handle_server_client_op(args, out[0], node);
+    return;
+  }
 
 // We want to check that every OP_TYPEID enumeration is included in the
 // list. These clang flags enable compile-time checking so that if an
@@ -939,11 +1146,13 @@ void HESealExecutable::generate_calls(
       if (m_he_seal_backend.lazy_mod()) {
         m_he_seal_backend.lazy_mod() = false;
         add_seal(args[0]->data(), args[1]->data(), out[0]->data(),
-                 out[0]->get_batched_element_count(), type, m_he_seal_backend);
+                 out[0]->get_batched_element_count(), type, m_he_seal_backend,
+                 m_memory_pools);
         m_he_seal_backend.lazy_mod() = true;
       } else {
         add_seal(args[0]->data(), args[1]->data(), out[0]->data(),
-                 out[0]->get_batched_element_count(), type, m_he_seal_backend);
+                 out[0]->get_batched_element_count(), type, m_he_seal_backend,
+                 m_memory_pools);
       }
       break;
     }
@@ -961,12 +1170,15 @@ void HESealExecutable::generate_calls(
           avg_pool->get_window_shape(), avg_pool->get_window_movement_strides(),
           avg_pool->get_padding_below(), avg_pool->get_padding_above(),
           avg_pool->get_include_padding_in_avg_computation(),
-          out[0]->get_batch_size(), m_he_seal_backend);
+          out[0]->get_batch_size(), m_he_seal_backend, m_memory_pools);
 
       if (m_he_seal_backend.lazy_mod()) {
         mod_reduce_seal(out[0]->data(), m_he_seal_backend, verbose);
       }
-      rescale_seal(out[0]->data(), m_he_seal_backend, verbose);
+      if (rescale) {
+        rescale_seal(out[0]->data(), m_he_seal_backend, verbose,
+                     m_memory_pools);
+      }
       break;
     }
     case OP_TYPEID::BatchNormInference: {
@@ -991,7 +1203,10 @@ void HESealExecutable::generate_calls(
       const auto bounded_relu = static_cast<const op::BoundedRelu*>(&node);
       float alpha = bounded_relu->get_alpha();
       size_t output_size = args[0]->get_batched_element_count();
-      if (enable_client()) {
+      if (enable_client() && HEOpAnnotations::client_fused(node)) {
+        // Evaluated by the client within the MaxPool round-trip
+        out[0]->data() = args[0]->data();
+      } else if (enable_client()) {
         handle_server_relu_op(args[0], out[0], node);
       } else {
         NGRAPH_WARN << "Performing BoundedRelu without client is not "
@@ -1049,12 +1264,19 @@ void HESealExecutable::generate_calls(
                        window_movement_strides, window_dilation_strides,
                        padding_below, padding_above, data_dilation_strides, 0,
                        1, 1, 0, 0, 1, type, batch_size(), m_he_seal_backend,
-                       verbose);
+                       verbose, !defer_relinearization, m_memory_pools);
 
       if (m_he_seal_backend.lazy_mod()) {
         mod_reduce_seal(out[0]->data(), m_he_seal_backend, verbose);
       }
-      rescale_seal(out[0]->data(), m_he_seal_backend, verbose);
+      if (defer_relinearization) {
+        relinearize_seal(out[0]->data(), m_he_seal_backend, verbose,
+                         m_memory_pools);
+      }
+      if (rescale) {
+        rescale_seal(out[0]->data(), m_he_seal_backend, verbose,
+                     m_memory_pools);
+      }
 
       break;
     }
@@ -1079,13 +1301,20 @@ void HESealExecutable::generate_calls(
         dot_seal(args[0]->data(), args[1]->data(), out[0]->data(), in_shape0,
                  in_shape1, out[0]->get_packed_shape(),
                  dot->get_reduction_axes_count(), type, batch_size(),
-                 m_he_seal_backend);
+                 m_he_seal_backend, !defer_relinearization, m_memory_pools);
       }
 
       if (m_he_seal_backend.lazy_mod()) {
         mod_reduce_seal(out[0]->data(), m_he_seal_backend, verbose);
       }
-      rescale_seal(out[0]->data(), m_he_seal_backend, verbose);
+      if (defer_relinearization) {
+        relinearize_seal(out[0]->data(), m_he_seal_backend, verbose,
+                         m_memory_pools);
+      }
+      if (rescale) {
+        rescale_seal(out[0]->data(), m_he_seal_backend, verbose,
+                     m_memory_pools);
+      }
 
       break;
     }
@@ -1149,14 +1378,17 @@ void HESealExecutable::generate_calls(
         m_he_seal_backend.lazy_mod() = false;
         multiply_seal(args[0]->data(), args[1]->data(), out[0]->data(),
                       out[0]->get_batched_element_count(), type,
-                      m_he_seal_backend);
+                      m_he_seal_backend, m_memory_pools);
         m_he_seal_backend.lazy_mod() = true;
       } else {
         multiply_seal(args[0]->data(), args[1]->data(), out[0]->data(),
                       out[0]->get_batched_element_count(), type,
-                      m_he_seal_backend);
+                      m_he_seal_backend, m_memory_pools);
+      }
+      if (rescale) {
+        rescale_seal(out[0]->data(), m_he_seal_backend, verbose,
+                     m_memory_pools);
       }
-      rescale_seal(out[0]->data(), m_he_seal_backend, verbose);
       break;
     }
     case OP_TYPEID::Negative: {
@@ -1186,7 +1418,10 @@ void HESealExecutable::generate_calls(
       break;
     }
     case OP_TYPEID::Relu: {
-      if (enable_client()) {
+      if (enable_client() && HEOpAnnotations::client_fused(node)) {
+        // Evaluated by the client within the MaxPool round-trip
+        out[0]->data() = args[0]->data();
+      } else if (enable_client()) {
         handle_server_relu_op(args[0], out[0], node);
       } else {
         NGRAPH_WARN << "Performing Relu without client is not privacy "
@@ -1429,31 +1664,64 @@ void HESealExecutable::handle_server_max_pool_op(
   bool verbose = verbose_op(&node);
   const auto* max_pool = static_cast<const op::MaxPool*>(&node);
 
-  m_max_pool_done = false;
-
   Shape unpacked_arg_shape = node.get_input_shape(0);
   Shape out_shape = HETensor::pack_shape(node.get_output_shape(0));
 
-  // TODO(fboemer): call max_pool_seal directly?
   std::vector<std::vector<size_t>> maximize_lists = max_pool_seal_max_list(
       unpacked_arg_shape, out_shape, max_pool->get_window_shape(),
       max_pool->get_window_movement_strides(), max_pool->get_padding_below(),
       max_pool->get_padding_above());
 
-  m_max_pool_data.clear();
+  // Each group of windows and its results are sent as single proto tensors,
+  // so the client answers each request with a single response. Groups are
+  // bounded by the size of a fresh ciphertext, as returned by the client, and
+  // kept well below the proto tensor limit, so the client maximizes one group
+  // while the next is written
+  const auto& first_parms = m_context->first_context_data()->parms();
+  size_t value_byte_count = 2 * first_parms.poly_modulus_degree() *
+                            first_parms.coeff_modulus().size() *
+                            sizeof(std::uint64_t);
+  size_t max_group_size = std::max(
+      HETensor::max_pb_tensor_byte_count / 4 / value_byte_count, size_t(1));
+  auto window_groups = group_max_lists(maximize_lists, max_group_size);
 
-  for (const auto& maximize_list : maximize_lists) {
+  {
+    std::lock_guard<std::mutex> guard(m_max_pool_mutex);
+    m_max_pool_data.clear();
+    m_max_pool_data.reserve(maximize_lists.size());
+    m_max_pool_window_count = maximize_lists.size();
+    m_max_pool_done = maximize_lists.empty();
+  }
+
+  // The client applies a fused activation to each pooled maximum
+  json js = json::parse(node_to_pb_function(node).function());
+  const Node* activation = node.input(0).get_source_output().get_node();
+  if (HEOpAnnotations::client_fused(*activation)) {
+    if (verbose) {
+      NGRAPH_HE_LOG(3) << "Fusing " << activation->get_name()
+                       << " into MaxPool round-trip";
+    }
+    js["activation"] =
+        json::parse(node_to_pb_function(*activation).function());
+  }
+
+  for (const auto& window_group : window_groups) {
     pb::TCPMessage pb_message;
     pb_message.set_type(pb::TCPMessage_Type_REQUEST);
 
-    json js = {{"function", node.description()}};
     pb::Function f;
     f.set_function(js.dump());
-    *pb_message.mutable_function() = f;
+    for (const auto& window : window_group.windows) {
+      f.add_window_sizes(window.size());
+      for (const size_t arg_idx : window) {
+        f.add_window_indices(arg_idx);
+      }
+    }
+    *pb_message.mutable_function() = std::move(f);
 
     std::vector<HEType> cipher_batch;
-    cipher_batch.reserve(maximize_list.size());
-    for (const size_t max_ind : maximize_list) {
+    cipher_batch.reserve(window_group.arg_indices.size());
+    for (const size_t max_ind : window_group.arg_indices) {
       cipher_batch.emplace_back(arg->data(max_ind));
     }
 
@@ -1465,30 +1733,102 @@ void HESealExecutable::handle_server_max_pool_op(
         cipher_batch[0].plaintext_packing(), cipher_batch[0].complex_packing(),
         true, m_he_seal_backend);
     max_pool_tensor.data() = cipher_batch;
-    const auto& pb_tensors = max_pool_tensor.write_to_pb_tensors();
-    NGRAPH_CHECK(pb_tensors.size() == 1,
-                 "Only support MaxPool with 1 proto tensor");
-    *pb_message.add_he_tensors() = pb_tensors[0];
+    // The client only decrypts the values to maximize over
+    if (m_he_seal_backend.mod_switch_outgoing()) {
+      mod_switch_to_lowest(max_pool_tensor.data(), m_he_seal_backend);
+    }
 
     // Send list of ciphertexts to maximize over to client
     if (verbose) {
       NGRAPH_HE_LOG(3) << "Sending " << cipher_batch.size()
-                       << " Maxpool ciphertexts to client";
+                       << " Maxpool ciphertexts for "
+                       << window_group.windows.size() << " windows to client";
     }
+    write_tensor(pb_message, max_pool_tensor, true);
+  }
+
+  // Wait until all windows are maximized
+  std::unique_lock<std::mutex> mlock(m_max_pool_mutex);
+  m_max_pool_cond.wait(mlock,
+                       std::bind(&HESealExecutable::max_pool_done, this));
+
+  // Reset for next max_pool call
+  m_max_pool_done = false;
+  out->data() = m_max_pool_data;
+}
 
-    m_session->write_message(TCPMessage(std::move(pb_message)));
+void HESealExecutable::handle_server_client_op(
+    const std::vector<std::shared_ptr<HETensor>>& args,
+    const std::shared_ptr<HETensor>& out, const Node& node) {
+  NGRAPH_HE_LOG(3) << "Server handle_server_client_op " << node.description();
+  client_op_round_trip(node.description(),
+                       ClientOpRegistry::instance().attributes(node), args,
+                       out, node.get_output_shape(0), verbose_op(&node));
+}
 
-    // Acquire lock
-    std::unique_lock<std::mutex> mlock(m_max_pool_mutex);
+void HESealExecutable::handle_server_refresh_op(
+    const std::shared_ptr<HETensor>& tensor, const Shape& shape,
+    const Node& node) {
+  NGRAPH_HE_LOG(3) << "Server handle_server_refresh_op " << node.get_name();
+  client_op_round_trip(ClientOpRegistry::refresh_op_name, json::object(),
+                       {tensor}, tensor, shape, verbose_op(&node));
+}
 
-    // Wait until max is done
-    m_max_pool_cond.wait(mlock,
-                         std::bind(&HESealExecutable::max_pool_done, this));
+void HESealExecutable::client_op_round_trip(
+    const std::string& function, const json& attributes,
+    const std::vector<std::shared_ptr<HETensor>>& args,
+    const std::shared_ptr<HETensor>& out, const Shape& out_shape,
+    bool verbose) {
+  std::vector<uint64_t> pb_out_shape{out_shape};
+  json js = {{"function", function},
+             {"arg_count", args.size()},
+             {"out_shape", pb_out_shape},
+             {"packed", out->is_packed()},
+             {"attributes", attributes}};
 
-    // Reset for next max_pool call
-    m_max_pool_done = false;
+  {
+    std::lock_guard<std::mutex> guard(m_client_op_mutex);
+    m_client_op_result = nullptr;
   }
-  out->data() = m_max_pool_data;
+
+  // The client reassembles each argument from its chunks by offset
+  for (size_t arg_idx = 0; arg_idx < args.size(); ++arg_idx) {
+    const auto& arg = args[arg_idx];
+    js["arg_index"] = arg_idx;
+
+    pb::TCPMessage pb_message;
+    pb_message.set_type(pb::TCPMessage_Type_REQUEST);
+    pb::Function f;
+    f.set_function(js.dump());
+    *pb_message.mutable_function() = f;
+
+    HETensor arg_tensor(arg->get_element_type(), arg->get_shape(),
+                        arg->is_packed(), complex_packing(), true,
+                        m_he_seal_backend);
+    arg_tensor.data() = arg->data();
+    // The client only decrypts the arguments
+    if (m_he_seal_backend.mod_switch_outgoing()) {
+      mod_switch_to_lowest(arg_tensor.data(), m_he_seal_backend);
+    }
+
+    if (verbose) {
+      NGRAPH_HE_LOG(3) << "Sending " << arg_tensor.data().size()
+                       << " values of argument " << arg_idx << " to client";
+    }
+    write_tensor(pb_message, arg_tensor, true);
+  }
+
+  // Wait until the result is loaded
+  std::unique_lock<std::mutex> mlock(m_client_op_mutex);
+  m_client_op_cond.wait(mlock, [this]() {
+    return m_client_op_result != nullptr && m_client_op_result->done_loading();
+  });
+
+  NGRAPH_CHECK(m_client_op_result->data().size() == out->data().size(),
+               "Client op result has ", m_client_op_result->data().size(),
+               " values, expected ", out->data().size());
+  out->data() = m_client_op_result->data();
+  m_client_op_result = nullptr;
 }
 
 void HESealExecutable::handle_server_relu_op(
@@ -1513,9 +1853,6 @@ void HESealExecutable::handle_server_relu_op(
 
   m_relu_data.resize(element_count, HEType(HEPlaintext(), false));
 
-  // TODO(fboemer): tune
-  const size_t max_relu_message_cnt = 1000;
-
   m_unknown_relu_idx.clear();
   m_unknown_relu_idx.reserve(element_count);
 
@@ -1558,6 +1895,12 @@ void HESealExecutable::handle_server_relu_op(
         Shape{cipher_batch[0].batch_size(), cipher_batch.size()},
         arg->is_packed(), false, true, m_he_seal_backend);
     relu_tensor->data() = cipher_batch;
+    // The client only decrypts the relu inputs. Garbled circuits switch the
+    // masked ciphertexts themselves
+    if (m_he_seal_backend.mod_switch_outgoing() &&
+        !enable_garbled_circuits()) {
+      mod_switch_to_lowest(relu_tensor->data(), m_he_seal_backend);
+    }
 
 #ifdef NGRAPH_HE_ABY_ENABLE
     if (enable_garbled_circuits()) {
@@ -1566,46 +1909,51 @@ void HESealExecutable::handle_server_relu_op(
     }
 #endif
 
-    const auto pb_tensors = relu_tensor->write_to_pb_tensors();
-    for (const auto& pb_tensor : pb_tensors) {
-      pb::TCPMessage write_msg;
-      write_msg.set_type(pb::TCPMessage_Type_REQUEST);
-      *write_msg.mutable_function() = node_to_pb_function(
-          node,
-          {{"enable_gc", bool_to_string(enable_garbled_circuits())},
-           {"num_aby_parties",
-            std::to_string(m_he_seal_backend.num_garbled_circuit_threads())}});
-
-      *write_msg.add_he_tensors() = pb_tensor;
-      TCPMessage relu_message(std::move(write_msg));
-
-      NGRAPH_HE_LOG(5) << "Server writing relu request message";
-      m_session->write_message(std::move(relu_message));
-
+    // Garbled circuits modify the ciphertexts while the request is written,
+    // so the ciphertexts are copied into the request
+    NGRAPH_HE_LOG(5) << "Server writing relu request message";
+    write_tensor(proto_msg, *relu_tensor, !enable_garbled_circuits(), [&]() {
 #ifdef NGRAPH_HE_ABY_ENABLE
       if (enable_garbled_circuits()) {
         m_aby_executor->run_aby_circuit(function_str, relu_tensor);
       }
 #endif
-    }
+    });
   };
 
-  // Process unknown values
+  // Process unknown values. Batches are sized in bytes by the batcher, which
+  // keeps a few batches in flight, so the client processes one batch while
+  // the next is written. The batcher caps each request to a single proto
+  // tensor, so the client can respond to each request as a standalone tensor
+  size_t cipher_size = 0;
+  if (!m_unknown_relu_idx.empty()) {
+    const auto& cipher =
+        arg->data(m_unknown_relu_idx[0]).get_ciphertext()->ciphertext();
+    cipher_size = ciphertext_size(cipher, codec_to_compr_mode(m_codec));
+  }
+
   std::vector<HEType> relu_ciphers_batch;
-  relu_ciphers_batch.reserve(max_relu_message_cnt);
+  size_t batch_start = 0;
+  while (batch_start < m_unknown_relu_idx.size()) {
+    size_t batch_size;
+    {
+      std::unique_lock<std::mutex> mlock(m_relu_mutex);
+      m_relu_cond.wait(mlock,
+                       [this]() { return m_relu_batcher.can_start_batch(); });
+      batch_size = std::min(m_relu_batcher.batch_size(cipher_size),
+                            m_unknown_relu_idx.size() - batch_start);
+      m_relu_batcher.start_batch(batch_size, batch_size * cipher_size);
+    }
 
-  for (const auto& unknown_relu_idx : m_unknown_relu_idx) {
-    NGRAPH_CHECK(arg->data(unknown_relu_idx).is_ciphertext(),
-                 "HEType should be ciphertext");
-    relu_ciphers_batch.emplace_back(arg->data(unknown_relu_idx));
-    if (relu_ciphers_batch.size() == max_relu_message_cnt) {
-      process_unknown_relu_ciphers_batch(relu_ciphers_batch);
-      relu_ciphers_batch.clear();
+    relu_ciphers_batch.clear();
+    relu_ciphers_batch.reserve(batch_size);
+    for (size_t idx = batch_start; idx < batch_start + batch_size; ++idx) {
+      const auto& he_type = arg->data(m_unknown_relu_idx[idx]);
+      NGRAPH_CHECK(he_type.is_ciphertext(), "HEType should be ciphertext");
+      relu_ciphers_batch.emplace_back(he_type);
     }
-  }
-  if (!relu_ciphers_batch.empty()) {
     process_unknown_relu_ciphers_batch(relu_ciphers_batch);
-    relu_ciphers_batch.clear();
+    batch_start += batch_size;
   }
 
   // Wait until all batches have been processed
@@ -1613,6 +1961,10 @@ void HESealExecutable::handle_server_relu_op(
   m_relu_cond.wait(
       mlock, [=]() { return m_relu_done_count == m_unknown_relu_idx.size(); });
   m_relu_done_count = 0;
+  if (verbose && !m_unknown_relu_idx.empty()) {
+    NGRAPH_HE_LOG(3) << "Relu round-trip batch size now "
+                     << m_relu_batcher.batch_byte_count() << " bytes";
+  }
 
   out->data() = m_relu_data;
 }
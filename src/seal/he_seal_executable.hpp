@@ -19,6 +19,7 @@
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <set>
@@ -33,11 +34,16 @@
 #include "logging/ngraph_he_log.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/util.hpp"
+#include "nlohmann/json.hpp"
 #include "seal/he_seal_backend.hpp"
 #include "seal/seal.h"
 #include "seal/seal_ciphertext_wrapper.hpp"
+#include "seal/seal_codec.hpp"
+#include "seal/seal_memory_pools.hpp"
+#include "tcp/round_trip_batcher.hpp"
 #include "tcp/tcp_message.hpp"
 #include "tcp/tcp_session.hpp"
+#include "tcp/tcp_transport.hpp"
 
 #ifdef NGRAPH_HE_ABY_ENABLE
 #include "aby/aby_server_executor.hpp"
@@ -119,8 +125,8 @@ class HESealExecutable : public runtime::Executable {
 
   /// \brief Checks whether or not the client supports the function
   /// \throws ngraph_error if function is unsupported
-  /// Currently, we only support functions with a single client parameter and
-  /// single results
+  /// Currently, we only support functions with at least one client
+  /// parameter. Results are streamed to the client in any number
   void check_client_supports_function();
 
   /// \brief Processes a message from the client
@@ -130,10 +136,20 @@ class HESealExecutable : public runtime::Executable {
   /// \brief Processes a client message with ciphertexts to call the appropriate
   /// function
   /// \param[in] pb_message Message to process
-  void handle_client_ciphers(const pb::TCPMessage& pb_message);
+  /// \param[in] payloads Raw ciphertext payloads of the message
+  void handle_client_ciphers(const pb::TCPMessage& pb_message,
+                             const CiphertextPayloads& payloads);
 
-  /// \brief Sends results to the client
-  void send_client_results();
+  /// \brief Streams a function result to the client as soon as it is
+  /// computed. Chunks are queued as they are serialized, so the client
+  /// decrypts early chunks while later chunks are in flight and the server
+  /// computes the remaining ops
+  /// \param[in] result_idx Index of the result in the function's results
+  /// \param[in] tensor Result tensor
+  void send_client_result(size_t result_idx, const HETensor& tensor);
+
+  /// \brief Waits until all results are written to the client
+  void finish_client_results();
 
   /// \brief Sends function's parameter shape to the client
   void send_inference_shape();
@@ -175,6 +191,32 @@ class HESealExecutable : public runtime::Executable {
   /// \brief Sets verbosity of all operations
   void set_verbose_all_ops(bool value);
 
+  /// \brief Returns the number of coefficient modulus levels consumed by the
+  /// function, as determined by the LevelAccounting pass
+  size_t levels_consumed() const { return m_levels_consumed; }
+
+  /// \brief Returns the codec negotiated with the client for serializing
+  /// ciphertexts
+  pb::Codec codec() const { return m_codec; }
+
+  /// \brief Returns the per-thread memory pools used by the kernels
+  const SealMemoryPools& memory_pools() const { return m_memory_pools; }
+
+  /// \brief Returns the number of bytes each op has allocated from the
+  /// per-thread memory pools, accumulated over all calls
+  const std::unordered_map<std::shared_ptr<const Node>, size_t>&
+  pool_alloc_byte_counts() const {
+    return m_pool_alloc_byte_counts;
+  }
+
+  /// \brief Returns the latency and delivery rate of the most recent ReLU
+  /// round-trip batches, over all calls
+  std::vector<RoundTripBatcher::BatchMetrics> relu_round_trip_metrics() {
+    std::lock_guard<std::mutex> guard(m_relu_mutex);
+    const auto& metrics = m_relu_batcher.metrics();
+    return {metrics.begin(), metrics.end()};
+  }
+
   static OP_TYPEID get_typeid(const NodeTypeInfo& type_info);
 
  private:
@@ -188,7 +230,10 @@ class HESealExecutable : public runtime::Executable {
                              const std::shared_ptr<HETensor>& out,
                              const Node& op);
 
-  /// \brief Processes the MaxPool operation using a client
+  /// \brief Processes the MaxPool operation using a client. Windows are sent
+  /// to the client in groups, each maximized in a single round-trip. A
+  /// client-fused activation producing the argument is applied by the client
+  /// to each maximum
   /// \param[in] arg Tensor argument
   /// \param[out] out Tensor result
   /// \param[in] op Operation to perform
@@ -196,19 +241,103 @@ class HESealExecutable : public runtime::Executable {
                                  const std::shared_ptr<HETensor>& out,
                                  const Node& op);
 
+  /// \brief Processes an op registered in the ClientOpRegistry using a
+  /// client. Each argument is sent in chunks, and the result is reassembled
+  /// from the client's chunks by offset
+  /// \param[in] args Tensor arguments
+  /// \param[out] out Tensor result
+  /// \param[in] op Operation to perform
+  void handle_server_client_op(
+      const std::vector<std::shared_ptr<HETensor>>& args,
+      const std::shared_ptr<HETensor>& out, const Node& op);
+
+  /// \brief Refreshes an encrypted tensor using a client, which re-encrypts
+  /// its values at the first level
+  /// \param[in,out] tensor Tensor to refresh
+  /// \param[in] shape Shape of the tensor, as seen by the graph
+  /// \param[in] op Operation whose output is refreshed
+  void handle_server_refresh_op(const std::shared_ptr<HETensor>& tensor,
+                                const Shape& shape, const Node& op);
+
+  /// \brief Sends the arguments of a ClientOpRegistry op to the client and
+  /// waits until the client's result is reassembled
+  /// \param[in] function Name of the op in the ClientOpRegistry
+  /// \param[in] attributes Op attributes used by the client op kernel
+  /// \param[in] args Tensor arguments
+  /// \param[out] out Tensor result
+  /// \param[in] out_shape Shape of the result, as seen by the graph
+  /// \param[in] verbose Whether or not to log the round-trip
+  void client_op_round_trip(const std::string& function,
+                            const nlohmann::json& attributes,
+                            const std::vector<std::shared_ptr<HETensor>>& args,
+                            const std::shared_ptr<HETensor>& out,
+                            const Shape& out_shape, bool verbose);
+
+  /// \brief Writes a tensor to the client as a stream of messages, each
+  /// storing a contiguous range of the tensor's values. Blocks while too many
+  /// messages are queued, so at most a few chunks are held in memory at once
+  /// \param[in] message Message to which each chunk of the tensor is added
+  /// \param[in] tensor Tensor to write
+  /// \param[in] raw_ciphertexts Whether or not to send ciphertexts as raw
+  /// payloads
+  /// \param[in] on_write If set, called after each message is queued
+  /// \param[in] stripe Whether or not to stripe the messages across all
+  /// connections to the client. Only valid if the client reassembles the
+  /// tensor by offset, regardless of the order in which chunks arrive
+  void write_tensor(const pb::TCPMessage& message, const HETensor& tensor,
+                    bool raw_ciphertexts,
+                    const std::function<void()>& on_write = nullptr,
+                    bool stripe = false);
+
+  /// \brief Returns the sessions to write to
+  /// \param[in] stripe Whether or not to include the additional connections
+  /// opened by the client, after the primary session
+  std::vector<std::shared_ptr<TCPSession>> sessions(bool stripe);
+
+  /// \brief Accepts additional connections from the client, across which
+  /// tensor chunks are striped. Must be called from the io thread
+  /// \param[in] count Number of connections to accept
+  void accept_stripe_connections(size_t count);
+
+  /// \brief Maximum number of tensor messages queued to be written before
+  /// write_tensor blocks
+  static constexpr size_t max_queued_tensor_messages = 4;
+
   /// \brief Processes a client message with ciphertexts after a ReLU function
   /// \param[in] pb_message Message to process
-  void handle_relu_result(const pb::TCPMessage& pb_message);
+  /// \param[in] payloads Raw ciphertext payloads of the message
+  void handle_relu_result(const pb::TCPMessage& pb_message,
+                          const CiphertextPayloads& payloads);
 
   /// \brief Processes a client message with ciphertextss after a BoundedReLU
   /// function
   /// \param[in] pb_message Message to process
-  void handle_bounded_relu_result(const pb::TCPMessage& pb_message);
+  /// \param[in] payloads Raw ciphertext payloads of the message
+  void handle_bounded_relu_result(const pb::TCPMessage& pb_message,
+                                  const CiphertextPayloads& payloads);
 
   /// \brief Processes a client message with ciphertextss after a MaxPool
   /// function
   /// \param[in] pb_message Message to process
-  void handle_max_pool_result(const pb::TCPMessage& pb_message);
+  /// \param[in] payloads Raw ciphertext payloads of the message
+  void handle_max_pool_result(const pb::TCPMessage& pb_message,
+                              const CiphertextPayloads& payloads);
+
+  /// \brief Processes a chunk of the result of an op in the ClientOpRegistry
+  /// \param[in] pb_message Message to process
+  /// \param[in] payloads Raw ciphertext payloads of the message
+  void handle_client_op_result(const pb::TCPMessage& pb_message,
+                               const CiphertextPayloads& payloads);
+
+  /// \brief Processes a client result message
+  using ClientResultHandler = std::function<void(const pb::TCPMessage&,
+                                                 const CiphertextPayloads&)>;
+
+  /// \brief Handlers of client results with dedicated round-trips, by
+  /// function name. Results of ops in the ClientOpRegistry are handled by
+  /// handle_client_op_result
+  std::unordered_map<std::string, ClientResultHandler>
+      m_client_result_handlers;
 
   HESealBackend& m_he_seal_backend;
   bool m_is_compiled{false};
@@ -222,6 +351,8 @@ class HESealExecutable : public runtime::Executable {
   bool m_server_setup{false};
   size_t m_batch_size;
   size_t m_port;  // Which port the server is hosted at
+  size_t m_levels_consumed{0};
+  pb::Codec m_codec{pb::CODEC_NONE};
 
 // ABY-related members
 #ifdef NGRAPH_HE_ABY_ENABLE
@@ -229,19 +360,23 @@ class HESealExecutable : public runtime::Executable {
 #endif
 
   std::unordered_map<std::shared_ptr<const Node>, stopwatch> m_timer_map;
+  std::unordered_map<std::shared_ptr<const Node>, size_t>
+      m_pool_alloc_byte_counts;
+  SealMemoryPools m_memory_pools;
   std::vector<std::shared_ptr<Node>> m_nodes;
 
-  std::unique_ptr<boost::asio::ip::tcp::acceptor> m_acceptor;
+  std::unique_ptr<stream_acceptor> m_acceptor;
 
   // Must be shared, since TCPSession uses enable_shared_from_this()
   std::shared_ptr<TCPSession> m_session;
+  // Additional connections opened by the client for striping
+  std::vector<std::shared_ptr<TCPSession>> m_stripe_sessions;
+  std::mutex m_stripe_sessions_mutex;
   std::thread m_message_handling_thread;
   boost::asio::io_context m_io_context;
 
   // (Encrypted) inputs to compiled function
   std::vector<std::shared_ptr<HETensor>> m_client_inputs;
-  // (Encrypted) outputs of compiled function
-  std::vector<std::shared_ptr<HETensor>> m_client_outputs;
 
   std::vector<HEType> m_relu_data;
   std::vector<HEType> m_max_pool_data;
@@ -255,15 +390,20 @@ class HESealExecutable : public runtime::Executable {
   std::condition_variable m_relu_cond;
   size_t m_relu_done_count{0};
   std::vector<size_t> m_unknown_relu_idx;
+  // Sizes relu requests, and measures their round-trips
+  RoundTripBatcher m_relu_batcher{HETensor::max_pb_tensor_byte_count};
 
   // To trigger when max_pool is done
   std::mutex m_max_pool_mutex;
   std::condition_variable m_max_pool_cond;
   bool m_max_pool_done{false};
+  // Number of MaxPool windows sent to the client
+  size_t m_max_pool_window_count{0};
 
-  // To trigger when result message has been written
-  std::mutex m_result_mutex;
-  std::condition_variable m_result_cond;
+  // To trigger when the result of a client op is loaded
+  std::mutex m_client_op_mutex;
+  std::condition_variable m_client_op_cond;
+  std::shared_ptr<HETensor> m_client_op_result;
 
   // To trigger when session has started
   std::mutex m_session_mutex;
@@ -81,6 +81,12 @@ void scalar_add_seal(SealCiphertextWrapper& arg0, SealCiphertextWrapper& arg1,
       }
     }
   }
+  // Copy remaining polynomials, e.g. when adding an unrelinearized product
+  if (encrypted2_size > encrypted1_size) {
+    std::copy_n(encrypted2.data(min_count),
+                (encrypted2_size - min_count) * coeff_mod_count * coeff_count,
+                encrypted1.data(min_count));
+  }
 }
 
 void scalar_add_seal(SealCiphertextWrapper& arg0, const HEPlaintext& arg1,
@@ -137,7 +143,8 @@ void scalar_add_seal(const HEPlaintext& arg0, const HEPlaintext& arg1,
 }
 
 void scalar_add_seal(HEType& arg0, HEType& arg1, HEType& out,
-                     HESealBackend& he_seal_backend) {
+                     HESealBackend& he_seal_backend,
+                     const seal::MemoryPoolHandle& pool) {
   NGRAPH_CHECK(arg0.complex_packing() == arg1.complex_packing(),
                "Complex packing types don't match");
   out.complex_packing() = arg0.complex_packing();
@@ -147,7 +154,7 @@ void scalar_add_seal(HEType& arg0, HEType& arg1, HEType& out,
       out.set_ciphertext(HESealBackend::create_empty_ciphertext());
     }
     scalar_add_seal(*arg0.get_ciphertext(), *arg1.get_ciphertext(),
-                    out.get_ciphertext(), he_seal_backend);
+                    out.get_ciphertext(), he_seal_backend, pool);
   } else if (arg0.is_ciphertext() && arg1.is_plaintext()) {
     if (!out.is_ciphertext()) {
       out.set_ciphertext(HESealBackend::create_empty_ciphertext());
@@ -174,7 +181,8 @@ void scalar_add_seal(HEType& arg0, HEType& arg1, HEType& out,
 void add_seal(std::vector<HEType>& arg0, std::vector<HEType>& arg1,
               std::vector<HEType>& out, size_t count,
               const element::Type& element_type,
-              HESealBackend& he_seal_backend) {
+              HESealBackend& he_seal_backend,
+              const SealMemoryPools& memory_pools) {
   NGRAPH_CHECK(he_seal_backend.is_supported_type(element_type),
                "Unsupported type ", element_type);
   NGRAPH_CHECK(count <= arg0.size(), "Count ", count,
@@ -184,7 +192,8 @@ void add_seal(std::vector<HEType>& arg0, std::vector<HEType>& arg1,
 
 #pragma omp parallel for
   for (size_t i = 0; i < count; ++i) {
-    scalar_add_seal(arg0[i], arg1[i], out[i], he_seal_backend);
+    scalar_add_seal(arg0[i], arg1[i], out[i], he_seal_backend,
+                    memory_pools.thread_pool());
   }
 }
 
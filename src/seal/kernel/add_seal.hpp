@@ -25,6 +25,7 @@
 #include "seal/kernel/negate_seal.hpp"
 #include "seal/seal.h"
 #include "seal/seal_ciphertext_wrapper.hpp"
+#include "seal/seal_memory_pools.hpp"
 
 namespace ngraph::runtime::he {
 /// \brief Adds two ciphertexts
@@ -77,8 +78,10 @@ void scalar_add_seal(const HEPlaintext& arg0, const HEPlaintext& arg1,
 /// \param[in] arg1 Cipher or plaintext data to add
 /// \param[in] out Stores the ciphertext or plaintext sum
 /// \param[in] he_seal_backend Backend used to perform addition
-void scalar_add_seal(HEType& arg0, HEType& arg1, HEType& out,
-                     HESealBackend& he_seal_backend);
+/// \param[in] pool Memory pool used for new memory allocation
+void scalar_add_seal(
+    HEType& arg0, HEType& arg1, HEType& out, HESealBackend& he_seal_backend,
+    const seal::MemoryPoolHandle& pool = seal::MemoryManager::GetPool());
 
 /// \brief Adds two vectors of ciphertext/plaintext elements element-wise
 /// \param[in] arg0 Cipher or plaintext data to add
@@ -87,9 +90,12 @@ void scalar_add_seal(HEType& arg0, HEType& arg1, HEType& out,
 /// \param[in] count Number of elements to add
 /// \param[in] element_type datatype of the data to add
 /// \param[in] he_seal_backend Backend used to perform addition
-void add_seal(std::vector<HEType>& arg0, std::vector<HEType>& arg1,
-              std::vector<HEType>& out, size_t count,
-              const element::Type& element_type,
-              HESealBackend& he_seal_backend);
+/// \param[in] memory_pools Per-thread memory pools used for new memory
+/// allocation
+void add_seal(
+    std::vector<HEType>& arg0, std::vector<HEType>& arg1,
+    std::vector<HEType>& out, size_t count, const element::Type& element_type,
+    HESealBackend& he_seal_backend,
+    const SealMemoryPools& memory_pools = SealMemoryPools::global());
 
 }  // namespace ngraph::runtime::he
@@ -26,6 +26,7 @@
 #include "seal/he_seal_backend.hpp"
 #include "seal/kernel/add_seal.hpp"
 #include "seal/kernel/multiply_seal.hpp"
+#include "seal/seal_memory_pools.hpp"
 
 namespace ngraph::runtime::he {
 inline void avg_pool_seal(std::vector<HEType>& arg, std::vector<HEType>& out,
@@ -35,7 +36,9 @@ inline void avg_pool_seal(std::vector<HEType>& arg, std::vector<HEType>& out,
                           const Shape& padding_below,
                           const Shape& padding_above,
                           bool include_padding_in_avg_computation,
-                          size_t batch_size, HESealBackend& he_seal_backend) {
+                          size_t batch_size, HESealBackend& he_seal_backend,
+                          const SealMemoryPools& memory_pools =
+                              SealMemoryPools::global()) {
   // TODO(fboemer): enable padding in avg pool computation
   NGRAPH_CHECK(!include_padding_in_avg_computation,
                "AvgPool doesn't support padding in computation");
@@ -110,54 +113,48 @@ inline void avg_pool_seal(std::vector<HEType>& arg, std::vector<HEType>& out,
         input_batch_transform_padding_below,
         input_batch_transform_padding_above);
 
-    // As we go, we compute the sum value:
+    // As we go, we accumulate the scaled sum value:
     //
-    //   output[O] := output[O] + arg[I]
+    //   output[O] := output[O] + arg[I] / n_elements
     //
-    // and the number of elements:
-    //
-    //   n_elements := n_elements + 1
+    // where n_elements is the number of in-bounds input elements. Scaling
+    // each term lets each input be streamed once into the accumulator, rather
+    // than multiplying the sum by 1 / n_elements in a separate pass
 
-    // T result = 0;
+    size_t n_elements = 0;
+    for (const Coordinate& input_batch_coord : input_batch_transform) {
+      if (input_batch_transform.has_source_coordinate(input_batch_coord)) {
+        n_elements++;
+      }
+    }
+    NGRAPH_CHECK(n_elements != 0, "AvgPool num_elements must be non-zero");
 
     // TODO(fboemer): better type which matches arguments?
     auto sum = HEType(HEPlaintext(), false);
     bool first_add = true;
 
-    size_t n_elements = 0;
-
     for (const Coordinate& input_batch_coord : input_batch_transform) {
       bool in_bounds =
           input_batch_transform.has_source_coordinate(input_batch_coord);
 
       if (in_bounds /* || include_padding_in_avg_computation */) {
-        // T v = in_bounds ?: 0;
-        // result += v;
+        auto& input = arg[input_batch_transform.index(input_batch_coord)];
+        // TODO(fboemer): batch size number of zeros?
+        auto inv_n_elements =
+            HEType(HEPlaintext(std::initializer_list<double>{1.f / n_elements}),
+                   input.complex_packing());
 
         if (first_add) {
-          sum = arg[input_batch_transform.index(input_batch_coord)];
-          // TODO(fboemer): batch size number of zeros?
-          HEPlaintext zero(std::initializer_list<double>{0});
-          out[out_coord_idx].set_plaintext(zero);
+          scalar_multiply_seal(input, inv_n_elements, sum, he_seal_backend,
+                               true, memory_pools.thread_pool());
           first_add = false;
         } else {
-          scalar_add_seal(sum,
-                          arg[input_batch_transform.index(input_batch_coord)],
-                          sum, he_seal_backend);
+          scalar_fma_seal(input, inv_n_elements, sum, he_seal_backend, true,
+                          memory_pools.thread_pool());
         }
-        n_elements++;
       }
     }
 
-    NGRAPH_CHECK(n_elements != 0, "AvgPool num_elements must be non-zero");
-    NGRAPH_CHECK(!first_add, "AvgPool must have > 1 elements to add");
-
-    // TODO(fboemer): batch size number of zeros?
-    auto inv_n_elements =
-        HEType(HEPlaintext(std::initializer_list<double>{1.f / n_elements}),
-               sum.complex_packing());
-
-    scalar_multiply_seal(sum, inv_n_elements, sum, he_seal_backend);
     out[out_coord_idx] = sum;
   }
 }
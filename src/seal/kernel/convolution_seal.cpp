@@ -33,7 +33,8 @@ void convolution_seal(
     size_t input_channel_axis_filters, size_t output_channel_axis_filters,
     size_t batch_axis_result, size_t output_channel_axis_result,
     const element::Type& element_type, size_t batch_size,
-    HESealBackend& he_seal_backend, bool verbose) {
+    HESealBackend& he_seal_backend, bool verbose, const bool relinearize,
+    const SealMemoryPools& memory_pools) {
   NGRAPH_CHECK(he_seal_backend.is_supported_type(element_type),
                "Unsupported type ", element_type);
 
@@ -177,6 +178,7 @@ void convolution_seal(
     CoordinateTransform::Iterator input_end = input_batch_transform.end();
     CoordinateTransform::Iterator filter_end = filter_transform.end();
 
+    const seal::MemoryPoolHandle& pool = memory_pools.thread_pool();
     // TODO(fboemer): better type which matches complex packing?
     auto sum = HEType(HEPlaintext(batch_size), false);
     bool first_add = true;
@@ -189,15 +191,13 @@ void convolution_seal(
         auto mult_arg0 = arg0[input_batch_transform.index(input_batch_coord)];
         auto mult_arg1 = arg1[filter_transform.index(filter_coord)];
 
-        // TODO(fboemer): better type which matches arguments?
-        auto prod = HEType(HEPlaintext(batch_size), false);
-
-        scalar_multiply_seal(mult_arg0, mult_arg1, prod, he_seal_backend);
         if (first_add) {
-          sum = prod;
+          scalar_multiply_seal(mult_arg0, mult_arg1, sum, he_seal_backend,
+                               relinearize, pool);
           first_add = false;
         } else {
-          scalar_add_seal(prod, sum, sum, he_seal_backend);
+          scalar_fma_seal(mult_arg0, mult_arg1, sum, he_seal_backend,
+                          relinearize, pool);
         }
       }
       ++input_it;
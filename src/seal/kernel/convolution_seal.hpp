@@ -26,9 +26,14 @@
 #include "seal/kernel/add_seal.hpp"
 #include "seal/kernel/multiply_seal.hpp"
 #include "seal/seal_ciphertext_wrapper.hpp"
+#include "seal/seal_memory_pools.hpp"
 
 namespace ngraph::runtime::he {
 
+/// \brief Computes the convolution of data with filters. If relinearize is
+/// false, ciphertext-ciphertext products are summed as size-3 ciphertexts, and
+/// the caller must relinearize the output, e.g. with relinearize_seal. New
+/// memory is allocated from the calling thread's pool in memory_pools
 void convolution_seal(
     const std::vector<HEType>& arg0, const std::vector<HEType>& arg1,
     std::vector<HEType>& out, const Shape& arg0_shape, const Shape& arg1_shape,
@@ -39,6 +44,8 @@ void convolution_seal(
     size_t input_channel_axis_filters, size_t output_channel_axis_filters,
     size_t batch_axis_result, size_t output_channel_axis_result,
     const element::Type& element_type, size_t batch_size,
-    HESealBackend& he_seal_backend, bool verbose = true);
+    HESealBackend& he_seal_backend, bool verbose = true,
+    const bool relinearize = true,
+    const SealMemoryPools& memory_pools = SealMemoryPools::global());
 
 }  // namespace ngraph::runtime::he
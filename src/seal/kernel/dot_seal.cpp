@@ -28,7 +28,8 @@ void dot_seal(const std::vector<HEType>& arg0, const std::vector<HEType>& arg1,
               std::vector<HEType>& out, const Shape& arg0_shape,
               const Shape& arg1_shape, const Shape& out_shape,
               size_t reduction_axes_count, const element::Type& element_type,
-              size_t batch_size, HESealBackend& he_seal_backend) {
+              size_t batch_size, HESealBackend& he_seal_backend,
+              const bool relinearize, const SealMemoryPools& memory_pools) {
   NGRAPH_CHECK(he_seal_backend.is_supported_type(element_type),
                "Unsupported type ", element_type);
   // Get the sizes of the dot axes. It's easiest to pull them from arg1
@@ -109,6 +110,7 @@ void dot_seal(const std::vector<HEType>& arg0, const std::vector<HEType>& arg1,
     auto arg0_it = std::copy(arg0_projected_coord.begin(),
                              arg0_projected_coord.end(), arg0_coord.begin());
 
+    const seal::MemoryPoolHandle& pool = memory_pools.thread_pool();
     auto sum = HEType(HEPlaintext(batch_size), false);
     bool first_add = true;
 
@@ -123,19 +125,17 @@ void dot_seal(const std::vector<HEType>& arg0, const std::vector<HEType>& arg1,
       std::copy(arg1_projected_coord.begin(), arg1_projected_coord.end(),
                 arg1_it);
 
-      // Multiply and add to the summands.
+      // Multiply and accumulate into the sum.
       auto mult_arg0 = arg0[arg0_transform.index(arg0_coord)];
       auto mult_arg1 = arg1[arg1_transform.index(arg1_coord)];
 
-      auto prod = HEType(HEPlaintext(batch_size), false);
-
       if (first_add) {
-        scalar_multiply_seal(mult_arg0, mult_arg1, prod, he_seal_backend);
-        sum = prod;
+        scalar_multiply_seal(mult_arg0, mult_arg1, sum, he_seal_backend,
+                             relinearize, pool);
         first_add = false;
       } else {
-        scalar_multiply_seal(mult_arg0, mult_arg1, prod, he_seal_backend);
-        scalar_add_seal(prod, sum, sum, he_seal_backend);
+        scalar_fma_seal(mult_arg0, mult_arg1, sum, he_seal_backend,
+                        relinearize, pool);
       }
     }
     // Write the sum back.
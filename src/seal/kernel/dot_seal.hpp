@@ -22,12 +22,32 @@
 #include "he_type.hpp"
 #include "ngraph/coordinate_transform.hpp"
 #include "seal/he_seal_backend.hpp"
+#include "seal/seal_memory_pools.hpp"
 
 namespace ngraph::runtime::he {
+/// \brief Computes the dot product of two tensors
+/// \param[in] arg0 Cipher or plaintext data of the first argument
+/// \param[in] arg1 Cipher or plaintext data of the second argument
+/// \param[out] out Stores the result
+/// \param[in] arg0_shape Shape of the first argument
+/// \param[in] arg1_shape Shape of the second argument
+/// \param[in] out_shape Shape of the output
+/// \param[in] reduction_axes_count Number of axes to reduce over
+/// \param[in] element_type Datatype of the data
+/// \param[in] batch_size Batch size of the data
+/// \param[in] he_seal_backend Backend used to perform the dot product
+/// \param[in] relinearize Whether or not to relinearize each
+/// ciphertext-ciphertext product. If false, the products are summed as size-3
+/// ciphertexts, and the caller must relinearize the output, e.g. with
+/// relinearize_seal
+/// \param[in] memory_pools Per-thread memory pools used for new memory
+/// allocation
 void dot_seal(const std::vector<HEType>& arg0, const std::vector<HEType>& arg1,
               std::vector<HEType>& out, const Shape& arg0_shape,
               const Shape& arg1_shape, const Shape& out_shape,
               size_t reduction_axes_count, const element::Type& element_type,
-              size_t batch_size, HESealBackend& he_seal_backend);
+              size_t batch_size, HESealBackend& he_seal_backend,
+              const bool relinearize = true,
+              const SealMemoryPools& memory_pools = SealMemoryPools::global());
 
 }  // namespace ngraph::runtime::he
@@ -19,6 +19,7 @@
 #include <cmath>
 #include <memory>
 #include <numeric>
+#include <unordered_map>
 #include <vector>
 
 #include "ngraph/coordinate_transform.hpp"
@@ -127,24 +128,88 @@ inline std::vector<std::vector<size_t>> max_pool_seal_max_list(
   return maximize_list;
 }
 
-inline void max_pool_seal(
-    const std::vector<HEType>& arg, std::vector<HEType>& out,
-    const Shape& arg_shape, const Shape& out_shape, const Shape& window_shape,
-    const Strides& window_movement_strides, const Shape& padding_below,
-    const Shape& padding_above, const seal::parms_id_type& parms_id,
-    double scale, seal::CKKSEncoder& ckks_encoder, seal::Encryptor& encryptor,
-    seal::Decryptor& decryptor, std::shared_ptr<seal::SEALContext> context) {
-  auto max_lists = max_pool_seal_max_list(arg_shape, out_shape, window_shape,
-                                          window_movement_strides,
-                                          padding_below, padding_above);
+/// \brief A group of MaxPool windows maximized by the client in one request
+struct MaxPoolWindowGroup {
+  /// \brief Distinct input indices referenced by the windows, in order of
+  /// first reference
+  std::vector<size_t> arg_indices;
+  /// \brief List where windows[i] is the list of indices into arg_indices to
+  /// maximize over for the i'th window of the group
+  std::vector<std::vector<size_t>> windows;
+};
+
+/// \brief Splits MaxPool windows into consecutive groups, each with at most
+/// max_group_size windows and max_group_size distinct inputs. Overlapping
+/// windows share inputs, so each input is stored once per group
+/// \param[in] max_lists List where max_lists[i] is the list of input indices to
+/// maximize over for output i
+/// \param[in] max_group_size Maximum number of windows, and of distinct
+/// inputs, per group
+/// \returns Groups covering max_lists in order
+inline std::vector<MaxPoolWindowGroup> group_max_lists(
+    const std::vector<std::vector<size_t>>& max_lists, size_t max_group_size) {
+  std::vector<MaxPoolWindowGroup> groups;
+  std::unordered_map<size_t, size_t> group_arg_indices;
+
+  for (const auto& max_list : max_lists) {
+    NGRAPH_CHECK(max_list.size() <= max_group_size, "MaxPool window size ",
+                 max_list.size(), " exceeds maximum group size ",
+                 max_group_size);
+
+    size_t new_arg_count = 0;
+    if (!groups.empty()) {
+      for (const size_t arg_idx : max_list) {
+        if (group_arg_indices.find(arg_idx) == group_arg_indices.end()) {
+          ++new_arg_count;
+        }
+      }
+    }
+    if (groups.empty() || groups.back().windows.size() == max_group_size ||
+        groups.back().arg_indices.size() + new_arg_count > max_group_size) {
+      groups.emplace_back();
+      group_arg_indices.clear();
+    }
 
+    auto& group = groups.back();
+    std::vector<size_t> window;
+    window.reserve(max_list.size());
+    for (const size_t arg_idx : max_list) {
+      auto it = group_arg_indices.find(arg_idx);
+      if (it == group_arg_indices.end()) {
+        it = group_arg_indices.emplace(arg_idx, group.arg_indices.size()).first;
+        group.arg_indices.emplace_back(arg_idx);
+      }
+      window.emplace_back(it->second);
+    }
+    group.windows.emplace_back(std::move(window));
+  }
+  return groups;
+}
+
+/// \brief Computes out[i] as the maximum of the inputs listed in max_lists[i].
+/// Windows are maximized in parallel
+/// \param[in] arg Input values
+/// \param[in,out] out Output values, one per list in max_lists
+/// \param[in] max_lists List where max_lists[i] is the list of input indices to
+/// maximize over for output i
+inline void max_lists_seal(const std::vector<HEType>& arg,
+                           std::vector<HEType>& out,
+                           const std::vector<std::vector<size_t>>& max_lists,
+                           const seal::parms_id_type& parms_id, double scale,
+                           seal::CKKSEncoder& ckks_encoder,
+                           seal::Encryptor& encryptor,
+                           seal::Decryptor& decryptor,
+                           const std::shared_ptr<seal::SEALContext>& context) {
+  NGRAPH_CHECK(out.size() == max_lists.size(), "Output size ", out.size(),
+               " doesn't match number of max lists ", max_lists.size());
+
+#pragma omp parallel for
   for (size_t out_idx = 0; out_idx < max_lists.size(); ++out_idx) {
-    auto& max_list = max_lists[out_idx];
+    const auto& max_list = max_lists[out_idx];
     std::vector<HEType> max_args(max_list.size(), HEType(HEPlaintext(), false));
     for (size_t i = 0; i < max_list.size(); ++i) {
       max_args[i] = arg[max_list[i]];
     }
-    Shape in_shape{max_list.size()};
 
     std::vector<HEType> max_out{out[out_idx]};
 
@@ -155,6 +220,21 @@ inline void max_pool_seal(
   }
 }
 
+inline void max_pool_seal(
+    const std::vector<HEType>& arg, std::vector<HEType>& out,
+    const Shape& arg_shape, const Shape& out_shape, const Shape& window_shape,
+    const Strides& window_movement_strides, const Shape& padding_below,
+    const Shape& padding_above, const seal::parms_id_type& parms_id,
+    double scale, seal::CKKSEncoder& ckks_encoder, seal::Encryptor& encryptor,
+    seal::Decryptor& decryptor, std::shared_ptr<seal::SEALContext> context) {
+  auto max_lists = max_pool_seal_max_list(arg_shape, out_shape, window_shape,
+                                          window_movement_strides,
+                                          padding_below, padding_above);
+
+  max_lists_seal(arg, out, max_lists, parms_id, scale, ckks_encoder, encryptor,
+                 decryptor, context);
+}
+
 inline void max_pool_seal(const std::vector<HEType>& arg,
                           std::vector<HEType>& out, const Shape& arg_shape,
                           const Shape& out_shape, const Shape& window_shape,
@@ -22,6 +22,7 @@
 #include "seal/he_seal_backend.hpp"
 #include "seal/seal.h"
 #include "seal/seal_ciphertext_wrapper.hpp"
+#include "seal/seal_simd.hpp"
 
 namespace ngraph::runtime::he {
 
@@ -50,21 +51,8 @@ inline void mod_reduce_seal(std::vector<HEType>& arg,
 
     for (size_t i = 0; i < encrypted_ntt_size; i++) {
       for (size_t j = 0; j < coeff_mod_count; j++) {
-        auto modulus = coeff_modulus[j];
-        const uint64_t modulus_value = modulus.value();
-        const uint64_t const_ratio_1 = modulus.const_ratio()[1];
-
-        for (size_t k = 0; k < coeff_count; ++k) {
-          std::uint64_t* poly = encrypted.data(i) + (j * coeff_count) + k;
-          //*poly = (*poly) % coeff_modulus[j].value(); via
-          // Barrett base 2^64 reduction
-          unsigned long long carry;
-          seal::util::multiply_uint64_hw64(*poly, const_ratio_1, &carry);
-          carry = *poly - carry * modulus_value;
-          *poly = carry - (modulus_value &
-                           static_cast<uint64_t>(
-                               -static_cast<int64_t>(carry >= modulus_value)));
-        }
+        std::uint64_t* poly = encrypted.data(i) + (j * coeff_count);
+        reduce_poly_coeffmod_simd(poly, coeff_count, coeff_modulus[j], poly);
       }
     }
   }
@@ -17,9 +17,11 @@
 #include "seal/kernel/multiply_seal.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <utility>
 
 #include "seal/he_seal_backend.hpp"
+#include "seal/kernel/add_seal.hpp"
 #include "seal/kernel/negate_seal.hpp"
 #include "seal/seal_util.hpp"
 
@@ -29,6 +31,7 @@ void scalar_multiply_seal(SealCiphertextWrapper& arg0,
                           SealCiphertextWrapper& arg1,
                           std::shared_ptr<SealCiphertextWrapper>& out,
                           bool complex_packing, HESealBackend& he_seal_backend,
+                          const bool relinearize,
                           const seal::MemoryPoolHandle& pool) {
   match_modulus_and_scale_inplace(arg0, arg1, he_seal_backend, pool);
   size_t chain_ind0 = he_seal_backend.get_chain_index(arg0);
@@ -48,9 +51,9 @@ void scalar_multiply_seal(SealCiphertextWrapper& arg0,
     seal::Ciphertext c1_conj;
 
     he_seal_backend.get_evaluator()->complex_conjugate(
-        c0, *he_seal_backend.get_galois_keys(), c0_conj);
+        c0, *he_seal_backend.get_galois_keys(), c0_conj, pool);
     he_seal_backend.get_evaluator()->complex_conjugate(
-        c1, *he_seal_backend.get_galois_keys(), c1_conj);
+        c1, *he_seal_backend.get_galois_keys(), c1_conj, pool);
 
     seal::Ciphertext c0_re;
     seal::Ciphertext c0_im;
@@ -71,8 +74,8 @@ void scalar_multiply_seal(SealCiphertextWrapper& arg0,
     seal::Ciphertext prod_re;
     seal::Ciphertext prod_im;
 
-    he_seal_backend.get_evaluator()->multiply(c0_re, c1_re, prod_re);
-    he_seal_backend.get_evaluator()->multiply(c0_im, c1_im, prod_im);
+    he_seal_backend.get_evaluator()->multiply(c0_re, c1_re, prod_re, pool);
+    he_seal_backend.get_evaluator()->multiply(c0_im, c1_im, prod_im, pool);
 
     he_seal_backend.get_evaluator()->relinearize_inplace(
         prod_re, *(he_seal_backend.get_relin_keys()), pool);
@@ -87,14 +90,16 @@ void scalar_multiply_seal(SealCiphertextWrapper& arg0,
     seal::Plaintext neg_i;
     ckks_encoder->encode(complex_vals, prod_im.parms_id(), encode_scale, neg_i);
 
-    he_seal_backend.get_evaluator()->multiply_plain_inplace(prod_im, neg_i);
+    he_seal_backend.get_evaluator()->multiply_plain_inplace(prod_im, neg_i,
+                                                            pool);
 
     std::vector<std::complex<double>> new_complex_vals(slot_count, {1, 0});
     seal::Plaintext fudge_re;
     ckks_encoder->encode(new_complex_vals, prod_re.parms_id(), encode_scale,
                          fudge_re);
 
-    he_seal_backend.get_evaluator()->multiply_plain_inplace(prod_re, fudge_re);
+    he_seal_backend.get_evaluator()->multiply_plain_inplace(prod_re, fudge_re,
+                                                            pool);
     he_seal_backend.get_evaluator()->add(prod_re, prod_im, out->ciphertext());
 
     he_seal_backend.get_evaluator()->rescale_to_next_inplace(out->ciphertext(),
@@ -108,8 +113,10 @@ void scalar_multiply_seal(SealCiphertextWrapper& arg0,
           arg0.ciphertext(), arg1.ciphertext(), out->ciphertext(), pool);
     }
 
-    he_seal_backend.get_evaluator()->relinearize_inplace(
-        out->ciphertext(), *(he_seal_backend.get_relin_keys()), pool);
+    if (relinearize) {
+      he_seal_backend.get_evaluator()->relinearize_inplace(
+          out->ciphertext(), *(he_seal_backend.get_relin_keys()), pool);
+    }
   }
 }
 
@@ -199,7 +206,9 @@ void scalar_multiply_seal(const HEPlaintext& arg0, const HEPlaintext& arg1,
 }
 
 void scalar_multiply_seal(HEType& arg0, HEType& arg1, HEType& out,
-                          HESealBackend& he_seal_backend) {
+                          HESealBackend& he_seal_backend,
+                          const bool relinearize,
+                          const seal::MemoryPoolHandle& pool) {
   if (arg0.is_ciphertext() && arg1.is_ciphertext()) {
     NGRAPH_CHECK(arg0.complex_packing() == arg1.complex_packing(),
                  "Complex packing types don't match");
@@ -208,19 +217,19 @@ void scalar_multiply_seal(HEType& arg0, HEType& arg1, HEType& out,
     }
     scalar_multiply_seal(*arg0.get_ciphertext(), *arg1.get_ciphertext(),
                          out.get_ciphertext(), arg0.complex_packing(),
-                         he_seal_backend);
+                         he_seal_backend, relinearize, pool);
   } else if (arg0.is_ciphertext() && arg1.is_plaintext()) {
     if (!out.is_ciphertext()) {
       out.set_ciphertext(HESealBackend::create_empty_ciphertext());
     }
     scalar_multiply_seal(*arg0.get_ciphertext(), arg1.get_plaintext(), out,
-                         he_seal_backend);
+                         he_seal_backend, pool);
   } else if (arg0.is_plaintext() && arg1.is_ciphertext()) {
     if (!out.is_ciphertext()) {
       out.set_ciphertext(HESealBackend::create_empty_ciphertext());
     }
     scalar_multiply_seal(*arg1.get_ciphertext(), arg0.get_plaintext(), out,
-                         he_seal_backend);
+                         he_seal_backend, pool);
   } else if (arg0.is_plaintext() && arg1.is_plaintext()) {
     NGRAPH_CHECK(arg0.complex_packing() == arg1.complex_packing(),
                  "Complex packing types don't match");
@@ -233,10 +242,56 @@ void scalar_multiply_seal(HEType& arg0, HEType& arg1, HEType& out,
   out.complex_packing() = arg0.complex_packing();
 }
 
+void scalar_fma_seal(HEType& arg0, HEType& arg1, HEType& acc,
+                     HESealBackend& he_seal_backend, const bool relinearize,
+                     const seal::MemoryPoolHandle& pool) {
+  HEType* cipher_arg = nullptr;
+  HEType* plain_arg = nullptr;
+  if (arg0.is_ciphertext() && arg1.is_plaintext()) {
+    cipher_arg = &arg0;
+    plain_arg = &arg1;
+  } else if (arg0.is_plaintext() && arg1.is_ciphertext()) {
+    cipher_arg = &arg1;
+    plain_arg = &arg0;
+  }
+
+  if (acc.is_ciphertext() && cipher_arg != nullptr &&
+      plain_arg->get_plaintext().size() == 1) {
+    double value = plain_arg->get_plaintext()[0];
+    // Matches scalar_multiply_seal, which yields a zero product
+    if (std::abs(value) < 1e-5f) {
+      return;
+    }
+    const seal::Ciphertext& encrypted =
+        cipher_arg->get_ciphertext()->ciphertext();
+    seal::Ciphertext& accumulator = acc.get_ciphertext()->ciphertext();
+    const double product_scale = encrypted.scale() * encrypted.scale();
+    bool fusable = accumulator.parms_id() == encrypted.parms_id() &&
+                   accumulator.is_ntt_form() && encrypted.is_ntt_form() &&
+                   accumulator.scale() / product_scale <= 1.05 &&
+                   product_scale / accumulator.scale() <= 1.05;
+    if (fusable) {
+      if (he_seal_backend.lazy_mod()) {
+        fma_plain_lazy_mod_inplace(accumulator, encrypted, value,
+                                   he_seal_backend, pool);
+      } else {
+        fma_plain_inplace(accumulator, encrypted, value, he_seal_backend,
+                          pool);
+      }
+      return;
+    }
+  }
+
+  auto prod = HEType(HEPlaintext(), false);
+  scalar_multiply_seal(arg0, arg1, prod, he_seal_backend, relinearize, pool);
+  scalar_add_seal(prod, acc, acc, he_seal_backend, pool);
+}
+
 void multiply_seal(std::vector<HEType>& arg0, std::vector<HEType>& arg1,
                    std::vector<HEType>& out, size_t count,
                    const element::Type& element_type,
-                   HESealBackend& he_seal_backend) {
+                   HESealBackend& he_seal_backend,
+                   const SealMemoryPools& memory_pools) {
   NGRAPH_CHECK(he_seal_backend.is_supported_type(element_type),
                "Unsupported type ", element_type);
   NGRAPH_CHECK(count <= arg0.size(), "Count ", count,
@@ -246,7 +301,8 @@ void multiply_seal(std::vector<HEType>& arg0, std::vector<HEType>& arg1,
 
 #pragma omp parallel for
   for (size_t i = 0; i < count; ++i) {
-    scalar_multiply_seal(arg0[i], arg1[i], out[i], he_seal_backend);
+    scalar_multiply_seal(arg0[i], arg1[i], out[i], he_seal_backend, true,
+                         memory_pools.thread_pool());
   }
 }
 
@@ -25,6 +25,7 @@
 #include "seal/kernel/negate_seal.hpp"
 #include "seal/seal.h"
 #include "seal/seal_ciphertext_wrapper.hpp"
+#include "seal/seal_memory_pools.hpp"
 
 namespace ngraph::runtime::he {
 /// \brief Multiplies two ciphertexts
@@ -34,11 +35,14 @@ namespace ngraph::runtime::he {
 /// \param[in] complex_packing Whether or not the ciphertext should be
 /// multiplied using complex packing
 /// \param[in] he_seal_backend Backend used to perform multiplication
+/// \param[in] relinearize Whether or not to relinearize the product. If
+/// false, the product is left as a size-3 ciphertext, which the caller must
+/// relinearize. Complex-packed products are always relinearized
 /// \param[in] pool Memory pool used for new memory allocation
 void scalar_multiply_seal(
     SealCiphertextWrapper& arg0, SealCiphertextWrapper& arg1,
     std::shared_ptr<SealCiphertextWrapper>& out, const bool complex_packing,
-    HESealBackend& he_seal_backend,
+    HESealBackend& he_seal_backend, const bool relinearize = true,
     const seal::MemoryPoolHandle& pool = seal::MemoryManager::GetPool());
 
 /// \brief Multiplies a ciphertext with a plaintext
@@ -64,8 +68,29 @@ void scalar_multiply_seal(const HEPlaintext& arg0, const HEPlaintext& arg1,
 /// \param[in] arg1 Cipher or plaintext data to multiply
 /// \param[in] out Stores the ciphertext or plaintext product
 /// \param[in] he_seal_backend Backend used to perform multiplication
-void scalar_multiply_seal(HEType& arg0, HEType& arg1, HEType& out,
-                          HESealBackend& he_seal_backend);
+/// \param[in] relinearize Whether or not to relinearize
+/// ciphertext-ciphertext products
+/// \param[in] pool Memory pool used for new memory allocation
+void scalar_multiply_seal(
+    HEType& arg0, HEType& arg1, HEType& out, HESealBackend& he_seal_backend,
+    const bool relinearize = true,
+    const seal::MemoryPoolHandle& pool = seal::MemoryManager::GetPool());
+
+/// \brief Multiplies two ciphertext/plaintext elements and adds the product
+/// to an accumulator, i.e. acc += arg0 * arg1. Ciphertext-scalar products are
+/// fused into the accumulator using fma_plain_inplace; other products are
+/// computed separately and then added
+/// \param[in] arg0 Cipher or plaintext data to multiply
+/// \param[in] arg1 Cipher or plaintext data to multiply
+/// \param[in,out] acc Stores the accumulated sum
+/// \param[in] he_seal_backend Backend used to perform multiplication
+/// \param[in] relinearize Whether or not to relinearize
+/// ciphertext-ciphertext products
+/// \param[in] pool Memory pool used for new memory allocation
+void scalar_fma_seal(
+    HEType& arg0, HEType& arg1, HEType& acc, HESealBackend& he_seal_backend,
+    const bool relinearize = true,
+    const seal::MemoryPoolHandle& pool = seal::MemoryManager::GetPool());
 
 /// \brief Multiplies two vectors of ciphertext/plaintext elements element-wise
 /// \param[in] arg0 Cipher or plaintext data to multiply
@@ -74,9 +99,12 @@ void scalar_multiply_seal(HEType& arg0, HEType& arg1, HEType& out,
 /// \param[in] count Number of elements to multiply
 /// \param[in] element_type datatype of the data to multiply
 /// \param[in] he_seal_backend Backend used to perform multiplication
-void multiply_seal(std::vector<HEType>& arg0, std::vector<HEType>& arg1,
-                   std::vector<HEType>& out, size_t count,
-                   const element::Type& element_type,
-                   HESealBackend& he_seal_backend);
+/// \param[in] memory_pools Per-thread memory pools used for new memory
+/// allocation
+void multiply_seal(
+    std::vector<HEType>& arg0, std::vector<HEType>& arg1,
+    std::vector<HEType>& out, size_t count, const element::Type& element_type,
+    HESealBackend& he_seal_backend,
+    const SealMemoryPools& memory_pools = SealMemoryPools::global());
 
 }  // namespace ngraph::runtime::he
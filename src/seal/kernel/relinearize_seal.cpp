@@ -0,0 +1,55 @@
+//*****************************************************************************
+// Copyright 2018-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "seal/kernel/relinearize_seal.hpp"
+
+#include <chrono>
+#include <vector>
+
+#include "logging/ngraph_he_log.hpp"
+
+namespace ngraph::runtime::he {
+
+void relinearize_seal(std::vector<HEType>& arg, HESealBackend& he_seal_backend,
+                      const bool verbose,
+                      const SealMemoryPools& memory_pools) {
+  if (verbose) {
+    NGRAPH_HE_LOG(3) << "Relinearizing " << arg.size() << " elements";
+  }
+
+  using Clock = std::chrono::high_resolution_clock;
+  auto t1 = Clock::now();
+
+#pragma omp parallel for
+  for (size_t i = 0; i < arg.size(); ++i) {  // NOLINT
+    if (arg[i].is_ciphertext() &&
+        arg[i].get_ciphertext()->ciphertext().size() > 2) {
+      he_seal_backend.get_evaluator()->relinearize_inplace(
+          arg[i].get_ciphertext()->ciphertext(),
+          *he_seal_backend.get_relin_keys(), memory_pools.thread_pool());
+    }
+  }
+  if (verbose) {
+    auto t2 = Clock::now();
+    NGRAPH_HE_LOG(3) << "Relinearize took "
+                     << std::chrono::duration_cast<std::chrono::milliseconds>(
+                            t2 - t1)
+                            .count()
+                     << "ms";
+  }
+}
+
+}  // namespace ngraph::runtime::he
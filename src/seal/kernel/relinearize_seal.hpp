@@ -0,0 +1,41 @@
+//*****************************************************************************
+// Copyright 2018-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <vector>
+
+#include "he_type.hpp"
+#include "seal/he_seal_backend.hpp"
+#include "seal/seal_ciphertext_wrapper.hpp"
+#include "seal/seal_memory_pools.hpp"
+
+namespace ngraph::runtime::he {
+
+/// \brief Relinearizes each ciphertext of size greater than two back to size
+/// two. Used to finalize the outputs of kernels which defer relinearization
+/// \param[in,out] arg Cipher or plaintext data to relinearize. Plaintexts are
+/// left unchanged
+/// \param[in] he_seal_backend Backend whose relinearization keys are used
+/// \param[in] verbose Whether or not to log the relinearization runtime
+/// \param[in] memory_pools Per-thread memory pools used for new memory
+/// allocation
+void relinearize_seal(
+    std::vector<HEType>& arg, HESealBackend& he_seal_backend,
+    const bool verbose = false,
+    const SealMemoryPools& memory_pools = SealMemoryPools::global());
+
+}  // namespace ngraph::runtime::he
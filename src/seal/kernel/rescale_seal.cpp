@@ -23,7 +23,7 @@
 namespace ngraph::runtime::he {
 
 void rescale_seal(std::vector<HEType>& arg, HESealBackend& he_seal_backend,
-                  const bool verbose) {
+                  const bool verbose, const SealMemoryPools& memory_pools) {
   if (verbose) {
     NGRAPH_HE_LOG(3) << "Rescaling " << arg.size() << " elements";
   }
@@ -71,7 +71,7 @@ void rescale_seal(std::vector<HEType>& arg, HESealBackend& he_seal_backend,
     auto cipher = arg[i];
     if (arg[i].is_ciphertext()) {
       he_seal_backend.get_evaluator()->rescale_to_next_inplace(
-          arg[i].get_ciphertext()->ciphertext());
+          arg[i].get_ciphertext()->ciphertext(), memory_pools.thread_pool());
     }
   }
   if (verbose) {
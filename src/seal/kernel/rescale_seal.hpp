@@ -21,10 +21,20 @@
 #include "he_type.hpp"
 #include "seal/he_seal_backend.hpp"
 #include "seal/seal_ciphertext_wrapper.hpp"
+#include "seal/seal_memory_pools.hpp"
 
 namespace ngraph::runtime::he {
 
-void rescale_seal(std::vector<HEType>& arg, HESealBackend& he_seal_backend,
-                  const bool verbose = false);
+/// \brief Rescales each ciphertext to the next level
+/// \param[in,out] arg Cipher or plaintext data to rescale. Plaintexts are left
+/// unchanged
+/// \param[in] he_seal_backend Backend used to perform rescaling
+/// \param[in] verbose Whether or not to log the rescaling runtime
+/// \param[in] memory_pools Per-thread memory pools used for new memory
+/// allocation
+void rescale_seal(
+    std::vector<HEType>& arg, HESealBackend& he_seal_backend,
+    const bool verbose = false,
+    const SealMemoryPools& memory_pools = SealMemoryPools::global());
 
 }  // namespace ngraph::runtime::he
@@ -0,0 +1,131 @@
+//*****************************************************************************
+// Copyright 2018-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "seal/seal_ciphertext_slab.hpp"
+
+#include <new>
+
+#include "ngraph/check.hpp"
+
+namespace ngraph::runtime::he {
+
+namespace {
+// Slots are aligned to cache lines
+constexpr size_t slab_alignment = 64;
+
+size_t align_byte_count(size_t byte_count) {
+  return (byte_count + slab_alignment - 1) / slab_alignment * slab_alignment;
+}
+
+SEAL_BYTE* allocate_slab(size_t byte_count) {
+  if (byte_count == 0) {
+    return nullptr;
+  }
+  return static_cast<SEAL_BYTE*>(
+      ::operator new(byte_count, std::align_val_t(slab_alignment)));
+}
+}  // namespace
+
+SealCiphertextSlab::Head::Head(SEAL_BYTE* data, size_t item_count,
+                               size_t item_byte_count)
+    : m_item_byte_count(item_byte_count) {
+  m_items.reserve(item_count);
+  for (size_t i = 0; i < item_count; ++i) {
+    m_items.emplace_back(data + i * item_byte_count);
+  }
+  // Hand out slots in slab order
+  m_free_items.reserve(item_count);
+  for (auto it = m_items.rbegin(); it != m_items.rend(); ++it) {
+    m_free_items.emplace_back(&*it);
+  }
+}
+
+bool SealCiphertextSlab::Head::reserve() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_reserved_count == m_free_items.size()) {
+    return false;
+  }
+  m_reserved_count++;
+  return true;
+}
+
+seal::util::MemoryPoolItem* SealCiphertextSlab::Head::get() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  NGRAPH_CHECK(m_reserved_count > 0 && !m_free_items.empty(),
+               "No slot reserved in ciphertext slab");
+  m_reserved_count--;
+  seal::util::MemoryPoolItem* item = m_free_items.back();
+  m_free_items.pop_back();
+  return item;
+}
+
+void SealCiphertextSlab::Head::add(
+    seal::util::MemoryPoolItem* new_first) noexcept {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_free_items.emplace_back(new_first);
+}
+
+size_t SealCiphertextSlab::Head::free_count() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_free_items.size() - m_reserved_count;
+}
+
+SealCiphertextSlab::SealCiphertextSlab(size_t item_count,
+                                       size_t item_byte_count)
+    : m_data(allocate_slab(item_count * align_byte_count(item_byte_count))),
+      m_byte_count(item_count * align_byte_count(item_byte_count)),
+      m_head(m_data, item_count, align_byte_count(item_byte_count)),
+      m_fallback_pool(seal::MemoryManager::GetPool()) {}
+
+SealCiphertextSlab::~SealCiphertextSlab() {
+  if (m_data != nullptr) {
+    ::operator delete(m_data, std::align_val_t(slab_alignment));
+  }
+}
+
+seal::MemoryPoolHandle SealCiphertextSlab::create_pool(
+    const std::shared_ptr<seal::SEALContext>& context, size_t item_count) {
+  return seal::MemoryPoolHandle(std::make_shared<SealCiphertextSlab>(
+      item_count, ciphertext_byte_count(context)));
+}
+
+size_t SealCiphertextSlab::ciphertext_byte_count(
+    const std::shared_ptr<seal::SEALContext>& context) {
+  NGRAPH_CHECK(context != nullptr, "Context is null");
+  const auto& parms = context->first_context_data()->parms();
+  return 2 * parms.poly_modulus_degree() * parms.coeff_modulus().size() *
+         sizeof(seal::Ciphertext::ct_coeff_type);
+}
+
+seal::util::Pointer<SEAL_BYTE> SealCiphertextSlab::get_for_byte_count(
+    std::size_t byte_count) {
+  if (byte_count == 0) {
+    return seal::util::Pointer<SEAL_BYTE>();
+  }
+  if (byte_count <= m_head.item_byte_count() && m_head.reserve()) {
+    return seal::util::Pointer<SEAL_BYTE>(&m_head);
+  }
+  return static_cast<seal::util::MemoryPool&>(m_fallback_pool)
+      .get_for_byte_count(byte_count);
+}
+
+bool SealCiphertextSlab::contains(const void* ptr) const {
+  const auto* byte_ptr = static_cast<const SEAL_BYTE*>(ptr);
+  return m_data != nullptr && byte_ptr >= m_data &&
+         byte_ptr < m_data + m_byte_count;
+}
+
+}  // namespace ngraph::runtime::he
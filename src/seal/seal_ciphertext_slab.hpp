@@ -0,0 +1,127 @@
+//*****************************************************************************
+// Copyright 2018-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "seal/seal.h"
+#include "seal/util/mempool.h"
+#include "seal/util/pointer.h"
+
+namespace ngraph::runtime::he {
+/// \brief SEAL memory pool which serves ciphertext allocations from a single
+/// contiguous, aligned slab of equally-sized slots. Ciphertexts created with
+/// this pool store their polynomials inside the slab, so a tensor of
+/// ciphertexts is backed by one allocation, rather than one per ciphertext.
+/// Requests larger than a slot, or made once all slots are in use, are served
+/// by SEAL's global memory pool.
+class SealCiphertextSlab : public seal::util::MemoryPool {
+ public:
+  /// \brief Creates a slab
+  /// \param[in] item_count Number of slots in the slab
+  /// \param[in] item_byte_count Size in bytes of each slot
+  SealCiphertextSlab(size_t item_count, size_t item_byte_count);
+
+  ~SealCiphertextSlab() override;
+
+  SealCiphertextSlab(const SealCiphertextSlab&) = delete;
+  SealCiphertextSlab& operator=(const SealCiphertextSlab&) = delete;
+
+  /// \brief Creates a memory pool handle to a slab with room for item_count
+  /// ciphertexts of size 2 at the first parms_id of the context
+  /// \param[in] context SEAL context determining the slot size
+  /// \param[in] item_count Number of ciphertexts the slab can hold
+  static seal::MemoryPoolHandle create_pool(
+      const std::shared_ptr<seal::SEALContext>& context, size_t item_count);
+
+  /// \brief Returns the number of bytes needed by a ciphertext of size 2 at
+  /// the first parms_id of the context
+  /// \param[in] context SEAL context storing the encryption parameters
+  static size_t ciphertext_byte_count(
+      const std::shared_ptr<seal::SEALContext>& context);
+
+  /// \brief Returns a slot if byte_count fits into one and a slot is free.
+  /// Otherwise, allocates from SEAL's global memory pool
+  /// \param[in] byte_count Number of bytes to allocate
+  seal::util::Pointer<SEAL_BYTE> get_for_byte_count(
+      std::size_t byte_count) override;
+
+  /// \brief Returns the number of slabs in the pool, i.e. one
+  std::size_t pool_count() const override { return 1; }
+
+  /// \brief Returns the number of bytes allocated by the slab
+  std::size_t alloc_byte_count() const override {
+    return m_head.item_count() * m_head.item_byte_count();
+  }
+
+  /// \brief Returns the number of slots in the slab
+  size_t item_count() const { return m_head.item_count(); }
+
+  /// \brief Returns the size in bytes of each slot
+  size_t item_byte_count() const { return m_head.item_byte_count(); }
+
+  /// \brief Returns the number of slots not currently in use
+  size_t free_count() const { return m_head.free_count(); }
+
+  /// \brief Returns the start of the slab
+  const SEAL_BYTE* data() const { return m_data; }
+
+  /// \brief Returns whether or not ptr points into the slab
+  bool contains(const void* ptr) const;
+
+ private:
+  /// \brief Free list of slots in the slab. Slots are claimed with reserve()
+  /// before a seal::util::Pointer takes them with get(), and are returned by
+  /// the pointer with add()
+  class Head : public seal::util::MemoryPoolHead {
+   public:
+    Head(SEAL_BYTE* data, size_t item_count, size_t item_byte_count);
+
+    std::size_t item_byte_count() const noexcept override {
+      return m_item_byte_count;
+    }
+
+    std::size_t item_count() const noexcept override { return m_items.size(); }
+
+    /// \brief Claims a free slot. Returns false if no slot is free
+    bool reserve();
+
+    /// \brief Takes a slot previously claimed with reserve()
+    seal::util::MemoryPoolItem* get() override;
+
+    /// \brief Returns a slot to the free list
+    void add(seal::util::MemoryPoolItem* new_first) noexcept override;
+
+    size_t free_count() const;
+
+   private:
+    size_t m_item_byte_count;
+    std::vector<seal::util::MemoryPoolItem> m_items;
+    std::vector<seal::util::MemoryPoolItem*> m_free_items;
+    size_t m_reserved_count{0};
+    mutable std::mutex m_mutex;
+  };
+
+  SEAL_BYTE* m_data;
+  size_t m_byte_count;
+  Head m_head;
+  seal::MemoryPoolHandle m_fallback_pool;
+};
+}  // namespace ngraph::runtime::he
@@ -16,6 +16,7 @@
 
 #include "seal/seal_ciphertext_wrapper.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
 #include <string>
@@ -30,15 +31,26 @@ namespace ngraph::runtime::he {
 
 SealCiphertextWrapper::SealCiphertextWrapper() = default;
 
-void SealCiphertextWrapper::save(pb::HEType& he_type) const {
-  size_t cipher_size = ciphertext_size(m_ciphertext);
+SealCiphertextWrapper::SealCiphertextWrapper(
+    const seal::MemoryPoolHandle& pool)
+    : m_ciphertext(pool) {}
+
+void SealCiphertextWrapper::save(pb::HEType& he_type,
+                                 seal::compr_mode_type compr_mode) const {
+  size_t cipher_size = ciphertext_size(m_ciphertext, compr_mode);
   std::string cipher_str;
   cipher_str.resize(cipher_size);
 
   size_t save_size = ngraph::runtime::he::save(
-      m_ciphertext, reinterpret_cast<std::byte*>(cipher_str.data()));
+      m_ciphertext, reinterpret_cast<std::byte*>(cipher_str.data()),
+      compr_mode);
 
-  NGRAPH_CHECK(save_size == cipher_size, "Save size != cipher size");
+  if (compr_mode == seal::compr_mode_type::none) {
+    NGRAPH_CHECK(save_size == cipher_size, "Save size != cipher size");
+  } else {
+    NGRAPH_CHECK(save_size <= cipher_size, "Save size > cipher size bound");
+    cipher_str.resize(save_size);
+  }
 
   he_type.set_ciphertext(std::move(cipher_str));
 }
@@ -55,4 +67,35 @@ void SealCiphertextWrapper::load(SealCiphertextWrapper& dst,
       reinterpret_cast<const std::byte*>(cipher_str.data()), cipher_str.size());
 }
 
+void SealCiphertextWrapper::save_metadata(
+    pb::RawCiphertext& raw_cipher) const {
+  const auto& parms_id = m_ciphertext.parms_id();
+  *raw_cipher.mutable_parms_id() = {parms_id.begin(), parms_id.end()};
+  raw_cipher.set_size(m_ciphertext.size());
+  raw_cipher.set_scale(m_ciphertext.scale());
+  raw_cipher.set_is_ntt_form(m_ciphertext.is_ntt_form());
+}
+
+void SealCiphertextWrapper::load_metadata(
+    SealCiphertextWrapper& dst, const pb::RawCiphertext& raw_cipher,
+    std::shared_ptr<seal::SEALContext> context) {
+  seal::parms_id_type parms_id;
+  NGRAPH_CHECK(static_cast<size_t>(raw_cipher.parms_id_size()) ==
+                   parms_id.size(),
+               "Invalid raw ciphertext parms_id size ",
+               raw_cipher.parms_id_size());
+  std::copy(raw_cipher.parms_id().begin(), raw_cipher.parms_id().end(),
+            parms_id.begin());
+  NGRAPH_CHECK(context->get_context_data(parms_id) != nullptr,
+               "Invalid raw ciphertext parms_id");
+  NGRAPH_CHECK(raw_cipher.size() >= SEAL_CIPHERTEXT_SIZE_MIN &&
+                   raw_cipher.size() <= SEAL_CIPHERTEXT_SIZE_MAX,
+               "Invalid raw ciphertext size ", raw_cipher.size());
+
+  auto& cipher = dst.ciphertext();
+  cipher.resize(std::move(context), parms_id, raw_cipher.size());
+  cipher.scale() = raw_cipher.scale();
+  cipher.is_ntt_form() = raw_cipher.is_ntt_form();
+}
+
 }  // namespace ngraph::runtime::he
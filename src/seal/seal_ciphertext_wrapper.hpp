@@ -17,8 +17,10 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "logging/ngraph_he_log.hpp"
 #include "ngraph/check.hpp"
@@ -26,20 +28,27 @@
 #include "seal/seal.h"
 
 namespace ngraph::runtime::he {
-/// \brief Returns the size in bytes required to serialize a ciphertext
+/// \brief Returns the size in bytes required to serialize a ciphertext. For
+/// compressed serialization, this is an upper bound
 /// \param[in] cipher Ciphertext to measure size of
-inline size_t ciphertext_size(const seal::Ciphertext& cipher) {
-  return cipher.save_size(seal::compr_mode_type::none);
+/// \param[in] compr_mode Compression mode used to serialize
+inline size_t ciphertext_size(
+    const seal::Ciphertext& cipher,
+    seal::compr_mode_type compr_mode = seal::compr_mode_type::none) {
+  return cipher.save_size(compr_mode);
 }
 
 /// \brief Serializes the ciphertext and writes to a destination
 /// \param[in] cipher Ciphertext to write
-/// \param[out] destination Where to save ciphertext to
+/// \param[out] destination Where to save ciphertext to. Must hold at least
+/// ciphertext_size(cipher, compr_mode) bytes
+/// \param[in] compr_mode Compression mode used to serialize
 /// \returns The size in bytes of the saved ciphertext
-inline std::size_t save(const seal::Ciphertext& cipher,
-                        std::byte* destination) {
-  return cipher.save(destination, ciphertext_size(cipher),
-                     seal::compr_mode_type::none);
+inline std::size_t save(
+    const seal::Ciphertext& cipher, std::byte* destination,
+    seal::compr_mode_type compr_mode = seal::compr_mode_type::none) {
+  return cipher.save(destination, ciphertext_size(cipher, compr_mode),
+                     compr_mode);
 }
 
 /// \brief Loads a serialized ciphertext
@@ -59,6 +68,10 @@ class SealCiphertextWrapper {
   /// \brief Create an empty ciphertext
   SealCiphertextWrapper();
 
+  /// \brief Create an empty ciphertext which allocates from the given pool
+  /// \param[in] pool Memory pool used to allocate the ciphertext data
+  explicit SealCiphertextWrapper(const seal::MemoryPoolHandle& pool);
+
   /// \brief Returns the ciphertext
   seal::Ciphertext& ciphertext() { return m_ciphertext; }
 
@@ -73,7 +86,9 @@ class SealCiphertextWrapper {
 
   /// \brief Writes the ciphertext to a protobuf object
   /// \param[out] he_type Protobuf object to write ciphertext to
-  void save(pb::HEType& he_type) const;
+  /// \param[in] compr_mode Compression mode used to serialize
+  void save(pb::HEType& he_type, seal::compr_mode_type compr_mode =
+                                     seal::compr_mode_type::none) const;
 
   /// \brief Loads a ciphertext from a protobuf object
   /// \param[out] dst Destination to load ciphertext to
@@ -82,8 +97,32 @@ class SealCiphertextWrapper {
   static void load(SealCiphertextWrapper& dst, const pb::HEType& pb_he_type,
                    std::shared_ptr<seal::SEALContext> context);
 
+  /// \brief Writes the ciphertext metadata, but not its data, to a protobuf
+  /// object. The data is sent separately as a raw payload
+  /// \param[out] raw_cipher Protobuf object to write metadata to
+  void save_metadata(pb::RawCiphertext& raw_cipher) const;
+
+  /// \brief Resizes a ciphertext to match the metadata in a protobuf object.
+  /// The data is left uninitialized, to be read in place from a raw payload
+  /// \param[out] dst Ciphertext to resize
+  /// \param[in] raw_cipher Protobuf object to load metadata from
+  /// \param[in] context SEAL context to validate metadata against
+  /// \throws ngraph_error if the metadata is invalid for the context
+  static void load_metadata(SealCiphertextWrapper& dst,
+                            const pb::RawCiphertext& raw_cipher,
+                            std::shared_ptr<seal::SEALContext> context);
+
+  /// \brief Returns the number of bytes of ciphertext data
+  size_t byte_count() const {
+    return m_ciphertext.uint64_count() * sizeof(std::uint64_t);
+  }
+
  private:
   seal::Ciphertext m_ciphertext;
 };
 
+/// \brief Ciphertexts sent as raw payloads of a binary TCP frame, indexed by
+/// pb::RawCiphertext::index. Entries which are not sent raw are null
+using CiphertextPayloads = std::vector<std::shared_ptr<SealCiphertextWrapper>>;
+
 }  // namespace ngraph::runtime::he
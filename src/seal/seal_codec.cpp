@@ -0,0 +1,99 @@
+//*****************************************************************************
+// Copyright 2018-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "seal/seal_codec.hpp"
+
+#include "ngraph/check.hpp"
+#include "ngraph/except.hpp"
+#include "ngraph/util.hpp"
+
+namespace ngraph::runtime::he {
+
+seal::compr_mode_type codec_to_compr_mode(pb::Codec codec) {
+  switch (codec) {
+    case pb::CODEC_NONE:
+      return seal::compr_mode_type::none;
+    case pb::CODEC_DEFLATE:
+#ifdef SEAL_USE_ZLIB
+      return seal::compr_mode_type::deflate;
+#else
+      break;
+#endif
+    default:
+      break;
+  }
+  NGRAPH_CHECK(false, "Codec ", codec_name(codec), " not supported");
+  return seal::compr_mode_type::none;
+}
+
+bool codec_supported(pb::Codec codec) {
+  switch (codec) {
+    case pb::CODEC_NONE:
+      return true;
+    case pb::CODEC_DEFLATE:
+#ifdef SEAL_USE_ZLIB
+      return true;
+#else
+      return false;
+#endif
+    default:
+      return false;
+  }
+}
+
+pb::Codec parse_codec(const std::string& name) {
+  std::string lower_name = to_lower(name);
+  if (lower_name == "none") {
+    return pb::CODEC_NONE;
+  }
+  if (lower_name == "deflate") {
+    return pb::CODEC_DEFLATE;
+  }
+  throw ngraph_error("Unknown codec " + name);
+}
+
+std::string codec_name(pb::Codec codec) {
+  switch (codec) {
+    case pb::CODEC_NONE:
+      return "none";
+    case pb::CODEC_DEFLATE:
+      return "deflate";
+    default:
+      return "unknown";
+  }
+}
+
+std::vector<pb::Codec> offered_codecs(pb::Codec preferred) {
+  std::vector<pb::Codec> codecs;
+  if (preferred != pb::CODEC_NONE && codec_supported(preferred)) {
+    codecs.emplace_back(preferred);
+  }
+  codecs.emplace_back(pb::CODEC_NONE);
+  return codecs;
+}
+
+pb::Codec negotiate_codec(
+    const pb::EncryptionParameters& encryption_parameters) {
+  for (int i = 0; i < encryption_parameters.codecs_size(); ++i) {
+    pb::Codec codec = encryption_parameters.codecs(i);
+    if (codec_supported(codec)) {
+      return codec;
+    }
+  }
+  return pb::CODEC_NONE;
+}
+
+}  // namespace ngraph::runtime::he
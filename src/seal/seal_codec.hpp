@@ -0,0 +1,54 @@
+//*****************************************************************************
+// Copyright 2018-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "protos/message.pb.h"
+#include "seal/seal.h"
+
+namespace ngraph::runtime::he {
+/// \brief Returns the SEAL compression mode used to serialize with a codec
+/// \param[in] codec Serialization codec
+/// \throws ngraph_error if SEAL does not support the codec
+seal::compr_mode_type codec_to_compr_mode(pb::Codec codec);
+
+/// \brief Returns whether or not SEAL supports serializing with a codec
+/// \param[in] codec Serialization codec
+bool codec_supported(pb::Codec codec);
+
+/// \brief Parses a codec name
+/// \param[in] name Codec name, "none" or "deflate"
+/// \throws ngraph_error if the name is not a known codec
+pb::Codec parse_codec(const std::string& name);
+
+/// \brief Returns the name of a codec
+/// \param[in] codec Serialization codec
+std::string codec_name(pb::Codec codec);
+
+/// \brief Returns the codecs the server offers, in order of preference. The
+/// preferred codec is offered first, followed by uncompressed serialization
+/// \param[in] preferred Preferred serialization codec
+std::vector<pb::Codec> offered_codecs(pb::Codec preferred);
+
+/// \brief Chooses the first offered codec which SEAL supports. Falls back to
+/// uncompressed serialization, which every peer supports
+/// \param[in] encryption_parameters Message with the offered codecs
+pb::Codec negotiate_codec(
+    const pb::EncryptionParameters& encryption_parameters);
+}  // namespace ngraph::runtime::he
@@ -0,0 +1,68 @@
+//*****************************************************************************
+// Copyright 2018-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "seal/seal_memory_pools.hpp"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace ngraph::runtime::he {
+
+SealMemoryPools::SealMemoryPools(size_t num_pools)
+    : m_global_pool(seal::MemoryManager::GetPool()) {
+  m_pools.reserve(num_pools);
+  for (size_t i = 0; i < num_pools; ++i) {
+    m_pools.emplace_back(seal::MemoryPoolHandle::New());
+  }
+}
+
+const seal::MemoryPoolHandle& SealMemoryPools::thread_pool() const {
+#ifdef _OPENMP
+  auto thread_num = static_cast<size_t>(omp_get_thread_num());
+  if (omp_get_level() <= 1 && thread_num < m_pools.size()) {
+    return m_pools[thread_num];
+  }
+#else
+  if (!m_pools.empty()) {
+    return m_pools[0];
+  }
+#endif
+  return m_global_pool;
+}
+
+size_t SealMemoryPools::alloc_byte_count() const {
+  size_t byte_count = 0;
+  for (const auto& pool : m_pools) {
+    byte_count += pool.alloc_byte_count();
+  }
+  return byte_count;
+}
+
+const SealMemoryPools& SealMemoryPools::global() {
+  static const SealMemoryPools global_pools(0);
+  return global_pools;
+}
+
+size_t SealMemoryPools::max_threads() {
+#ifdef _OPENMP
+  return static_cast<size_t>(omp_get_max_threads());
+#else
+  return 1;
+#endif
+}
+
+}  // namespace ngraph::runtime::he
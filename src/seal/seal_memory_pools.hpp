@@ -0,0 +1,58 @@
+//*****************************************************************************
+// Copyright 2018-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "seal/seal.h"
+
+namespace ngraph::runtime::he {
+/// \brief Set of SEAL memory pools with one pool per OpenMP thread. Kernels
+/// running in a parallel region allocate from the pool of the calling thread,
+/// rather than contending on SEAL's global memory pool
+class SealMemoryPools {
+ public:
+  /// \brief Creates one memory pool per thread
+  /// \param[in] num_pools Number of pools to create. If zero, every thread
+  /// uses SEAL's global memory pool
+  explicit SealMemoryPools(size_t num_pools = max_threads());
+
+  /// \brief Returns the memory pool of the calling OpenMP thread. Threads
+  /// without a pool of their own, e.g. in nested parallel regions, use SEAL's
+  /// global memory pool
+  const seal::MemoryPoolHandle& thread_pool() const;
+
+  /// \brief Returns the number of per-thread pools
+  size_t size() const { return m_pools.size(); }
+
+  /// \brief Returns the total number of bytes allocated by the per-thread
+  /// pools
+  size_t alloc_byte_count() const;
+
+  /// \brief Returns a set of pools which all use SEAL's global memory pool.
+  /// Used by kernels which are not provided with per-thread pools
+  static const SealMemoryPools& global();
+
+  /// \brief Returns the maximum number of OpenMP threads
+  static size_t max_threads();
+
+ private:
+  std::vector<seal::MemoryPoolHandle> m_pools;
+  seal::MemoryPoolHandle m_global_pool;
+};
+}  // namespace ngraph::runtime::he
@@ -0,0 +1,580 @@
+//*****************************************************************************
+// Copyright 2018-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "seal/seal_simd.hpp"
+
+#include "logging/ngraph_he_log.hpp"
+#include "seal/util/polyarithsmallmod.h"
+#include "seal/util/uintarith.h"
+#include "seal/util/uintarithsmallmod.h"
+
+#if (defined(__x86_64__) || defined(_M_X64)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define NGRAPH_HE_X86_SIMD
+#include <immintrin.h>
+#endif
+
+namespace ngraph::runtime::he {
+
+namespace {
+// The vectorized multiplications use 32x32->64 bit lane products, so they
+// require all operands to fit in 32 bits
+constexpr uint64_t max_simd_modulus = 1ULL << 32U;
+
+// The lazy kernels take coefficients which are not reduced, e.g. the sum of
+// two reduced coefficients, which is less than 2 * modulus. These fit in 32
+// bits only for moduli less than 2^31
+constexpr uint64_t max_lazy_simd_modulus = 1ULL << 31U;
+
+inline bool use_simd(SIMDLevel level, const seal::SmallModulus& modulus) {
+  return level != SIMDLevel::scalar && modulus.value() < max_simd_modulus;
+}
+
+inline bool use_lazy_simd(SIMDLevel level, const seal::SmallModulus& modulus) {
+  return level != SIMDLevel::scalar && modulus.value() < max_lazy_simd_modulus;
+}
+
+// Scalar implementations, also used for the tail of the vectorized loops
+
+void add_poly_scalar_coeffmod_scalar(const uint64_t* poly, size_t coeff_count,
+                                     uint64_t scalar, uint64_t modulus_value,
+                                     uint64_t* result) {
+  for (; coeff_count--; result++, poly++) {
+    uint64_t sum = *poly + scalar;
+    *result = sum - (modulus_value &
+                     static_cast<uint64_t>(
+                         -static_cast<int64_t>(sum >= modulus_value)));
+  }
+}
+
+void multiply_poly_scalar_coeffmod_scalar(const uint64_t* poly,
+                                          size_t coeff_count, uint64_t scalar,
+                                          const seal::SmallModulus& modulus,
+                                          uint64_t* result) {
+  if (modulus.value() >= (1ULL << 31U)) {
+    // Product may overflow 64 bits
+    seal::util::multiply_poly_scalar_coeffmod(poly, coeff_count, scalar,
+                                              modulus, result);
+    return;
+  }
+  const uint64_t modulus_value = modulus.value();
+  const uint64_t const_ratio_1 = modulus.const_ratio()[1];
+
+  // NOLINTNEXTLINE
+  for (; coeff_count--; poly++, result++) {
+    // Multiplication
+    auto z = *poly * scalar;
+
+    // Barrett base 2^64 reduction
+    // NOLINTNEXTLINE(runtime/int)
+    unsigned long long carry;
+    // Carry will store the result modulo 2^64
+    seal::util::multiply_uint64_hw64(z, const_ratio_1, &carry);
+    // Barrett subtraction
+    carry = z - carry * modulus_value;
+    // Possible correction term
+    *result =
+        carry -
+        (modulus_value &
+         static_cast<uint64_t>(-static_cast<int64_t>(carry >= modulus_value)));
+  }
+}
+
+void multiply_poly_scalar_lazy_scalar(const uint64_t* poly, size_t coeff_count,
+                                      uint64_t scalar, uint64_t* result) {
+#pragma omp simd
+  for (size_t k = 0; k < coeff_count; k++) {
+    result[k] = poly[k] * scalar;
+  }
+}
+
+void multiply_add_poly_scalar_coeffmod_scalar(const uint64_t* poly,
+                                              size_t coeff_count,
+                                              uint64_t scalar,
+                                              const seal::SmallModulus& modulus,
+                                              uint64_t* acc) {
+  const uint64_t modulus_value = modulus.value();
+  if (modulus_value >= (1ULL << 31U)) {
+    // Product may overflow 64 bits
+    for (; coeff_count--; poly++, acc++) {
+      *acc = seal::util::add_uint_uint_mod(
+          *acc, seal::util::multiply_uint_uint_mod(*poly, scalar, modulus),
+          modulus);
+    }
+    return;
+  }
+  const uint64_t const_ratio_1 = modulus.const_ratio()[1];
+
+  for (; coeff_count--; poly++, acc++) {
+    auto z = *poly * scalar;
+    // Barrett base 2^64 reduction
+    // NOLINTNEXTLINE(runtime/int)
+    unsigned long long carry;
+    seal::util::multiply_uint64_hw64(z, const_ratio_1, &carry);
+    carry = z - carry * modulus_value;
+    // Sum of the accumulator and the product is < 3 * modulus_value
+    uint64_t sum = *acc + carry;
+    sum -= (modulus_value &
+            static_cast<uint64_t>(-static_cast<int64_t>(sum >= modulus_value)));
+    *acc = sum - (modulus_value &
+                  static_cast<uint64_t>(
+                      -static_cast<int64_t>(sum >= modulus_value)));
+  }
+}
+
+void multiply_add_poly_scalar_lazy_scalar(const uint64_t* poly,
+                                          size_t coeff_count, uint64_t scalar,
+                                          uint64_t* acc) {
+#pragma omp simd
+  for (size_t k = 0; k < coeff_count; k++) {
+    acc[k] += poly[k] * scalar;
+  }
+}
+
+void reduce_poly_coeffmod_scalar(const uint64_t* poly, size_t coeff_count,
+                                 const seal::SmallModulus& modulus,
+                                 uint64_t* result) {
+  const uint64_t modulus_value = modulus.value();
+  const uint64_t const_ratio_1 = modulus.const_ratio()[1];
+
+  for (; coeff_count--; poly++, result++) {
+    // Barrett base 2^64 reduction
+    // NOLINTNEXTLINE(runtime/int)
+    unsigned long long carry;
+    seal::util::multiply_uint64_hw64(*poly, const_ratio_1, &carry);
+    carry = *poly - carry * modulus_value;
+    *result = carry - (modulus_value &
+                       static_cast<uint64_t>(
+                           -static_cast<int64_t>(carry >= modulus_value)));
+  }
+}
+
+#ifdef NGRAPH_HE_X86_SIMD
+// The vectorized kernels reduce with Shoup's method: for a modulus p < 2^32,
+// an operand w < p and its precomputed quotient w' = floor(w * 2^32 / p), the
+// product x * w mod p for any x < 2^32 is x * w - floor(x * w' / 2^32) * p,
+// up to a single correction by p. All products are 32x32->64 bit, which maps
+// onto the lane-wise _mm*_mul_epu32 instructions.
+
+inline uint64_t shoup_quotient(uint64_t operand, uint64_t modulus_value) {
+  return (operand << 32U) / modulus_value;
+}
+
+__attribute__((target("avx2"))) inline __m256i shoup_multiply_avx2(
+    __m256i x, __m256i w, __m256i w_shoup, __m256i p, __m256i p_minus_1) {
+  __m256i q = _mm256_srli_epi64(_mm256_mul_epu32(x, w_shoup), 32);
+  __m256i r =
+      _mm256_sub_epi64(_mm256_mul_epu32(x, w), _mm256_mul_epu32(q, p));
+  // r < 2p < 2^63, so the signed comparison is exact
+  __m256i mask = _mm256_cmpgt_epi64(r, p_minus_1);
+  return _mm256_sub_epi64(r, _mm256_and_si256(mask, p));
+}
+
+__attribute__((target("avx2"))) void add_poly_scalar_coeffmod_avx2(
+    const uint64_t* poly, size_t coeff_count, uint64_t scalar,
+    uint64_t modulus_value, uint64_t* result) {
+  const __m256i v_scalar = _mm256_set1_epi64x(scalar);
+  const __m256i v_p = _mm256_set1_epi64x(modulus_value);
+  const __m256i v_p_minus_1 = _mm256_set1_epi64x(modulus_value - 1);
+  size_t k = 0;
+  for (; k + 4 <= coeff_count; k += 4) {
+    __m256i x =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(poly + k));
+    // SEAL moduli are at most 61 bits, so the sum fits in a signed lane
+    __m256i sum = _mm256_add_epi64(x, v_scalar);
+    __m256i mask = _mm256_cmpgt_epi64(sum, v_p_minus_1);
+    sum = _mm256_sub_epi64(sum, _mm256_and_si256(mask, v_p));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(result + k), sum);
+  }
+  add_poly_scalar_coeffmod_scalar(poly + k, coeff_count - k, scalar,
+                                  modulus_value, result + k);
+}
+
+__attribute__((target("avx2"))) void multiply_poly_scalar_coeffmod_avx2(
+    const uint64_t* poly, size_t coeff_count, uint64_t scalar,
+    const seal::SmallModulus& modulus, uint64_t* result) {
+  const uint64_t modulus_value = modulus.value();
+  const __m256i v_w = _mm256_set1_epi64x(scalar);
+  const __m256i v_w_shoup =
+      _mm256_set1_epi64x(shoup_quotient(scalar, modulus_value));
+  const __m256i v_p = _mm256_set1_epi64x(modulus_value);
+  const __m256i v_p_minus_1 = _mm256_set1_epi64x(modulus_value - 1);
+  size_t k = 0;
+  for (; k + 4 <= coeff_count; k += 4) {
+    __m256i x =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(poly + k));
+    __m256i r = shoup_multiply_avx2(x, v_w, v_w_shoup, v_p, v_p_minus_1);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(result + k), r);
+  }
+  multiply_poly_scalar_coeffmod_scalar(poly + k, coeff_count - k, scalar,
+                                       modulus, result + k);
+}
+
+__attribute__((target("avx2"))) void multiply_poly_scalar_lazy_avx2(
+    const uint64_t* poly, size_t coeff_count, uint64_t scalar,
+    uint64_t* result) {
+  const __m256i v_scalar = _mm256_set1_epi64x(scalar);
+  size_t k = 0;
+  for (; k + 4 <= coeff_count; k += 4) {
+    __m256i x =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(poly + k));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(result + k),
+                        _mm256_mul_epu32(x, v_scalar));
+  }
+  multiply_poly_scalar_lazy_scalar(poly + k, coeff_count - k, scalar,
+                                   result + k);
+}
+
+__attribute__((target("avx2"))) void multiply_add_poly_scalar_coeffmod_avx2(
+    const uint64_t* poly, size_t coeff_count, uint64_t scalar,
+    const seal::SmallModulus& modulus, uint64_t* acc) {
+  const uint64_t modulus_value = modulus.value();
+  const __m256i v_w = _mm256_set1_epi64x(scalar);
+  const __m256i v_w_shoup =
+      _mm256_set1_epi64x(shoup_quotient(scalar, modulus_value));
+  const __m256i v_p = _mm256_set1_epi64x(modulus_value);
+  const __m256i v_p_minus_1 = _mm256_set1_epi64x(modulus_value - 1);
+  size_t k = 0;
+  for (; k + 4 <= coeff_count; k += 4) {
+    __m256i x =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(poly + k));
+    __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(acc + k));
+    __m256i r = shoup_multiply_avx2(x, v_w, v_w_shoup, v_p, v_p_minus_1);
+    __m256i sum = _mm256_add_epi64(a, r);
+    __m256i mask = _mm256_cmpgt_epi64(sum, v_p_minus_1);
+    sum = _mm256_sub_epi64(sum, _mm256_and_si256(mask, v_p));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(acc + k), sum);
+  }
+  multiply_add_poly_scalar_coeffmod_scalar(poly + k, coeff_count - k, scalar,
+                                           modulus, acc + k);
+}
+
+__attribute__((target("avx2"))) void multiply_add_poly_scalar_lazy_avx2(
+    const uint64_t* poly, size_t coeff_count, uint64_t scalar,
+    uint64_t* acc) {
+  const __m256i v_scalar = _mm256_set1_epi64x(scalar);
+  size_t k = 0;
+  for (; k + 4 <= coeff_count; k += 4) {
+    __m256i x =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(poly + k));
+    __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(acc + k));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(acc + k),
+                        _mm256_add_epi64(a, _mm256_mul_epu32(x, v_scalar)));
+  }
+  multiply_add_poly_scalar_lazy_scalar(poly + k, coeff_count - k, scalar,
+                                       acc + k);
+}
+
+__attribute__((target("avx2"))) void reduce_poly_coeffmod_avx2(
+    const uint64_t* poly, size_t coeff_count,
+    const seal::SmallModulus& modulus, uint64_t* result) {
+  // x = hi * 2^32 + lo, so x mod p = (hi * (2^32 mod p) + lo * 1) mod p
+  const uint64_t modulus_value = modulus.value();
+  const uint64_t two_32_mod_p = max_simd_modulus % modulus_value;
+  const __m256i v_c = _mm256_set1_epi64x(two_32_mod_p);
+  const __m256i v_c_shoup =
+      _mm256_set1_epi64x(shoup_quotient(two_32_mod_p, modulus_value));
+  const __m256i v_one = _mm256_set1_epi64x(1);
+  const __m256i v_one_shoup =
+      _mm256_set1_epi64x(shoup_quotient(1, modulus_value));
+  const __m256i v_p = _mm256_set1_epi64x(modulus_value);
+  const __m256i v_p_minus_1 = _mm256_set1_epi64x(modulus_value - 1);
+  size_t k = 0;
+  for (; k + 4 <= coeff_count; k += 4) {
+    __m256i x =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(poly + k));
+    __m256i hi = _mm256_srli_epi64(x, 32);
+    __m256i r_hi = shoup_multiply_avx2(hi, v_c, v_c_shoup, v_p, v_p_minus_1);
+    __m256i r_lo =
+        shoup_multiply_avx2(x, v_one, v_one_shoup, v_p, v_p_minus_1);
+    __m256i sum = _mm256_add_epi64(r_hi, r_lo);
+    __m256i mask = _mm256_cmpgt_epi64(sum, v_p_minus_1);
+    sum = _mm256_sub_epi64(sum, _mm256_and_si256(mask, v_p));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(result + k), sum);
+  }
+  reduce_poly_coeffmod_scalar(poly + k, coeff_count - k, modulus, result + k);
+}
+
+__attribute__((target("avx512f"))) inline __m512i shoup_multiply_avx512(
+    __m512i x, __m512i w, __m512i w_shoup, __m512i p) {
+  __m512i q = _mm512_srli_epi64(_mm512_mul_epu32(x, w_shoup), 32);
+  __m512i r =
+      _mm512_sub_epi64(_mm512_mul_epu32(x, w), _mm512_mul_epu32(q, p));
+  __mmask8 mask = _mm512_cmpge_epu64_mask(r, p);
+  return _mm512_mask_sub_epi64(r, mask, r, p);
+}
+
+__attribute__((target("avx512f"))) void add_poly_scalar_coeffmod_avx512(
+    const uint64_t* poly, size_t coeff_count, uint64_t scalar,
+    uint64_t modulus_value, uint64_t* result) {
+  const __m512i v_scalar = _mm512_set1_epi64(scalar);
+  const __m512i v_p = _mm512_set1_epi64(modulus_value);
+  size_t k = 0;
+  for (; k + 8 <= coeff_count; k += 8) {
+    __m512i sum = _mm512_add_epi64(_mm512_loadu_si512(poly + k), v_scalar);
+    __mmask8 mask = _mm512_cmpge_epu64_mask(sum, v_p);
+    sum = _mm512_mask_sub_epi64(sum, mask, sum, v_p);
+    _mm512_storeu_si512(result + k, sum);
+  }
+  add_poly_scalar_coeffmod_scalar(poly + k, coeff_count - k, scalar,
+                                  modulus_value, result + k);
+}
+
+__attribute__((target("avx512f"))) void multiply_poly_scalar_coeffmod_avx512(
+    const uint64_t* poly, size_t coeff_count, uint64_t scalar,
+    const seal::SmallModulus& modulus, uint64_t* result) {
+  const uint64_t modulus_value = modulus.value();
+  const __m512i v_w = _mm512_set1_epi64(scalar);
+  const __m512i v_w_shoup =
+      _mm512_set1_epi64(shoup_quotient(scalar, modulus_value));
+  const __m512i v_p = _mm512_set1_epi64(modulus_value);
+  size_t k = 0;
+  for (; k + 8 <= coeff_count; k += 8) {
+    __m512i r = shoup_multiply_avx512(_mm512_loadu_si512(poly + k), v_w,
+                                      v_w_shoup, v_p);
+    _mm512_storeu_si512(result + k, r);
+  }
+  multiply_poly_scalar_coeffmod_scalar(poly + k, coeff_count - k, scalar,
+                                       modulus, result + k);
+}
+
+__attribute__((target("avx512f"))) void multiply_poly_scalar_lazy_avx512(
+    const uint64_t* poly, size_t coeff_count, uint64_t scalar,
+    uint64_t* result) {
+  const __m512i v_scalar = _mm512_set1_epi64(scalar);
+  size_t k = 0;
+  for (; k + 8 <= coeff_count; k += 8) {
+    _mm512_storeu_si512(
+        result + k, _mm512_mul_epu32(_mm512_loadu_si512(poly + k), v_scalar));
+  }
+  multiply_poly_scalar_lazy_scalar(poly + k, coeff_count - k, scalar,
+                                   result + k);
+}
+
+__attribute__((target("avx512f"))) void
+multiply_add_poly_scalar_coeffmod_avx512(const uint64_t* poly,
+                                         size_t coeff_count, uint64_t scalar,
+                                         const seal::SmallModulus& modulus,
+                                         uint64_t* acc) {
+  const uint64_t modulus_value = modulus.value();
+  const __m512i v_w = _mm512_set1_epi64(scalar);
+  const __m512i v_w_shoup =
+      _mm512_set1_epi64(shoup_quotient(scalar, modulus_value));
+  const __m512i v_p = _mm512_set1_epi64(modulus_value);
+  size_t k = 0;
+  for (; k + 8 <= coeff_count; k += 8) {
+    __m512i r = shoup_multiply_avx512(_mm512_loadu_si512(poly + k), v_w,
+                                      v_w_shoup, v_p);
+    __m512i sum = _mm512_add_epi64(_mm512_loadu_si512(acc + k), r);
+    __mmask8 mask = _mm512_cmpge_epu64_mask(sum, v_p);
+    sum = _mm512_mask_sub_epi64(sum, mask, sum, v_p);
+    _mm512_storeu_si512(acc + k, sum);
+  }
+  multiply_add_poly_scalar_coeffmod_scalar(poly + k, coeff_count - k, scalar,
+                                           modulus, acc + k);
+}
+
+__attribute__((target("avx512f"))) void multiply_add_poly_scalar_lazy_avx512(
+    const uint64_t* poly, size_t coeff_count, uint64_t scalar,
+    uint64_t* acc) {
+  const __m512i v_scalar = _mm512_set1_epi64(scalar);
+  size_t k = 0;
+  for (; k + 8 <= coeff_count; k += 8) {
+    __m512i prod = _mm512_mul_epu32(_mm512_loadu_si512(poly + k), v_scalar);
+    _mm512_storeu_si512(acc + k,
+                        _mm512_add_epi64(_mm512_loadu_si512(acc + k), prod));
+  }
+  multiply_add_poly_scalar_lazy_scalar(poly + k, coeff_count - k, scalar,
+                                       acc + k);
+}
+
+__attribute__((target("avx512f"))) void reduce_poly_coeffmod_avx512(
+    const uint64_t* poly, size_t coeff_count,
+    const seal::SmallModulus& modulus, uint64_t* result) {
+  // x = hi * 2^32 + lo, so x mod p = (hi * (2^32 mod p) + lo * 1) mod p
+  const uint64_t modulus_value = modulus.value();
+  const uint64_t two_32_mod_p = max_simd_modulus % modulus_value;
+  const __m512i v_c = _mm512_set1_epi64(two_32_mod_p);
+  const __m512i v_c_shoup =
+      _mm512_set1_epi64(shoup_quotient(two_32_mod_p, modulus_value));
+  const __m512i v_one = _mm512_set1_epi64(1);
+  const __m512i v_one_shoup =
+      _mm512_set1_epi64(shoup_quotient(1, modulus_value));
+  const __m512i v_p = _mm512_set1_epi64(modulus_value);
+  size_t k = 0;
+  for (; k + 8 <= coeff_count; k += 8) {
+    __m512i x = _mm512_loadu_si512(poly + k);
+    __m512i r_hi =
+        shoup_multiply_avx512(_mm512_srli_epi64(x, 32), v_c, v_c_shoup, v_p);
+    __m512i r_lo = shoup_multiply_avx512(x, v_one, v_one_shoup, v_p);
+    __m512i sum = _mm512_add_epi64(r_hi, r_lo);
+    __mmask8 mask = _mm512_cmpge_epu64_mask(sum, v_p);
+    sum = _mm512_mask_sub_epi64(sum, mask, sum, v_p);
+    _mm512_storeu_si512(result + k, sum);
+  }
+  reduce_poly_coeffmod_scalar(poly + k, coeff_count - k, modulus, result + k);
+}
+#endif
+
+}  // namespace
+
+SIMDLevel simd_level() {
+  static const SIMDLevel level = [] {
+    SIMDLevel detected = SIMDLevel::scalar;
+#ifdef NGRAPH_HE_X86_SIMD
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+      detected = SIMDLevel::avx512;
+    } else if (__builtin_cpu_supports("avx2")) {
+      detected = SIMDLevel::avx2;
+    }
+#endif
+    NGRAPH_HE_LOG(3) << "Using " << detected << " polynomial kernels";
+    return detected;
+  }();
+  return level;
+}
+
+std::ostream& operator<<(std::ostream& os, const SIMDLevel& level) {
+  switch (level) {
+    case SIMDLevel::scalar:
+      os << "scalar";
+      break;
+    case SIMDLevel::avx2:
+      os << "AVX2";
+      break;
+    case SIMDLevel::avx512:
+      os << "AVX-512";
+      break;
+  }
+  return os;
+}
+
+void add_poly_scalar_coeffmod_simd(const uint64_t* poly, size_t coeff_count,
+                                   uint64_t scalar,
+                                   const seal::SmallModulus& modulus,
+                                   uint64_t* result, SIMDLevel level) {
+  const uint64_t modulus_value = modulus.value();
+#ifdef NGRAPH_HE_X86_SIMD
+  switch (level) {
+    case SIMDLevel::avx512:
+      add_poly_scalar_coeffmod_avx512(poly, coeff_count, scalar, modulus_value,
+                                      result);
+      return;
+    case SIMDLevel::avx2:
+      add_poly_scalar_coeffmod_avx2(poly, coeff_count, scalar, modulus_value,
+                                    result);
+      return;
+    case SIMDLevel::scalar:
+      break;
+  }
+#endif
+  add_poly_scalar_coeffmod_scalar(poly, coeff_count, scalar, modulus_value,
+                                  result);
+}
+
+void multiply_poly_scalar_coeffmod_simd(const uint64_t* poly,
+                                        size_t coeff_count, uint64_t scalar,
+                                        const seal::SmallModulus& modulus,
+                                        uint64_t* result, SIMDLevel level) {
+#ifdef NGRAPH_HE_X86_SIMD
+  if (use_simd(level, modulus)) {
+    if (level == SIMDLevel::avx512) {
+      multiply_poly_scalar_coeffmod_avx512(poly, coeff_count, scalar, modulus,
+                                           result);
+    } else {
+      multiply_poly_scalar_coeffmod_avx2(poly, coeff_count, scalar, modulus,
+                                         result);
+    }
+    return;
+  }
+#endif
+  multiply_poly_scalar_coeffmod_scalar(poly, coeff_count, scalar, modulus,
+                                       result);
+}
+
+void multiply_poly_scalar_lazy_simd(const uint64_t* poly, size_t coeff_count,
+                                    uint64_t scalar,
+                                    const seal::SmallModulus& modulus,
+                                    uint64_t* result, SIMDLevel level) {
+#ifdef NGRAPH_HE_X86_SIMD
+  if (use_lazy_simd(level, modulus)) {
+    if (level == SIMDLevel::avx512) {
+      multiply_poly_scalar_lazy_avx512(poly, coeff_count, scalar, result);
+    } else {
+      multiply_poly_scalar_lazy_avx2(poly, coeff_count, scalar, result);
+    }
+    return;
+  }
+#endif
+  multiply_poly_scalar_lazy_scalar(poly, coeff_count, scalar, result);
+}
+
+void multiply_add_poly_scalar_coeffmod_simd(const uint64_t* poly,
+                                            size_t coeff_count,
+                                            uint64_t scalar,
+                                            const seal::SmallModulus& modulus,
+                                            uint64_t* acc, SIMDLevel level) {
+#ifdef NGRAPH_HE_X86_SIMD
+  if (use_simd(level, modulus)) {
+    if (level == SIMDLevel::avx512) {
+      multiply_add_poly_scalar_coeffmod_avx512(poly, coeff_count, scalar,
+                                               modulus, acc);
+    } else {
+      multiply_add_poly_scalar_coeffmod_avx2(poly, coeff_count, scalar,
+                                             modulus, acc);
+    }
+    return;
+  }
+#endif
+  multiply_add_poly_scalar_coeffmod_scalar(poly, coeff_count, scalar, modulus,
+                                           acc);
+}
+
+void multiply_add_poly_scalar_lazy_simd(const uint64_t* poly,
+                                        size_t coeff_count, uint64_t scalar,
+                                        const seal::SmallModulus& modulus,
+                                        uint64_t* acc, SIMDLevel level) {
+#ifdef NGRAPH_HE_X86_SIMD
+  if (use_lazy_simd(level, modulus)) {
+    if (level == SIMDLevel::avx512) {
+      multiply_add_poly_scalar_lazy_avx512(poly, coeff_count, scalar, acc);
+    } else {
+      multiply_add_poly_scalar_lazy_avx2(poly, coeff_count, scalar, acc);
+    }
+    return;
+  }
+#endif
+  multiply_add_poly_scalar_lazy_scalar(poly, coeff_count, scalar, acc);
+}
+
+void reduce_poly_coeffmod_simd(const uint64_t* poly, size_t coeff_count,
+                               const seal::SmallModulus& modulus,
+                               uint64_t* result, SIMDLevel level) {
+#ifdef NGRAPH_HE_X86_SIMD
+  if (use_simd(level, modulus)) {
+    if (level == SIMDLevel::avx512) {
+      reduce_poly_coeffmod_avx512(poly, coeff_count, modulus, result);
+    } else {
+      reduce_poly_coeffmod_avx2(poly, coeff_count, modulus, result);
+    }
+    return;
+  }
+#endif
+  reduce_poly_coeffmod_scalar(poly, coeff_count, modulus, result);
+}
+
+}  // namespace ngraph::runtime::he
@@ -0,0 +1,140 @@
+//*****************************************************************************
+// Copyright 2018-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+#include "seal/seal.h"
+
+namespace ngraph::runtime::he {
+/// \brief Instruction set extensions used by the vectorized polynomial kernels
+enum class SIMDLevel { scalar, avx2, avx512 };
+
+/// \brief Returns the most capable instruction set extension supported by the
+/// CPU, as determined by CPUID at runtime
+SIMDLevel simd_level();
+
+std::ostream& operator<<(std::ostream& os, const SIMDLevel& level);
+
+/// \brief Adds a scalar to each element of a polynomial modulo modulus
+/// \param[in] poly Polynomial to add to. Each coefficient must be less than
+/// the modulus
+/// \param[in] coeff_count Number of coefficients in the polynomial
+/// \param[in] scalar Value to add. Must be less than the modulus
+/// \param[in] modulus Modulus with which to reduce each sum
+/// \param[out] result Stores the result. May alias poly
+/// \param[in] level Instruction set extension to use
+void add_poly_scalar_coeffmod_simd(const std::uint64_t* poly,
+                                   std::size_t coeff_count,
+                                   std::uint64_t scalar,
+                                   const seal::SmallModulus& modulus,
+                                   std::uint64_t* result,
+                                   SIMDLevel level = simd_level());
+
+/// \brief Multiplies each element of a polynomial with a scalar modulo
+/// modulus. The vectorized implementations require the modulus to be less
+/// than 2^32; otherwise the scalar implementation is used
+/// \param[in] poly Polynomial to multiply. Each coefficient must be less than
+/// the modulus
+/// \param[in] coeff_count Number of coefficients in the polynomial
+/// \param[in] scalar Value with which to multiply. Must be less than the
+/// modulus
+/// \param[in] modulus Modulus with which to reduce each product
+/// \param[out] result Stores the result. May alias poly
+/// \param[in] level Instruction set extension to use
+void multiply_poly_scalar_coeffmod_simd(const std::uint64_t* poly,
+                                        std::size_t coeff_count,
+                                        std::uint64_t scalar,
+                                        const seal::SmallModulus& modulus,
+                                        std::uint64_t* result,
+                                        SIMDLevel level = simd_level());
+
+/// \brief Multiplies each element of a polynomial with a scalar without
+/// modular reduction, i.e. modulo 2^64. The vectorized implementations require
+/// the modulus to be less than 2^31; otherwise the scalar implementation is
+/// used
+/// \param[in] poly Polynomial to multiply. Each coefficient must be less than
+/// twice the modulus, e.g. the unreduced sum of two coefficients
+/// \param[in] coeff_count Number of coefficients in the polynomial
+/// \param[in] scalar Value with which to multiply. Must be less than the
+/// modulus
+/// \param[in] modulus Modulus of the polynomial
+/// \param[out] result Stores the result. May alias poly
+/// \param[in] level Instruction set extension to use
+void multiply_poly_scalar_lazy_simd(const std::uint64_t* poly,
+                                    std::size_t coeff_count,
+                                    std::uint64_t scalar,
+                                    const seal::SmallModulus& modulus,
+                                    std::uint64_t* result,
+                                    SIMDLevel level = simd_level());
+
+/// \brief Multiplies each element of a polynomial with a scalar and adds the
+/// product to an accumulator modulo modulus, i.e. acc = (acc + poly * scalar)
+/// mod modulus. The vectorized implementations require the modulus to be less
+/// than 2^32; otherwise the scalar implementation is used
+/// \param[in] poly Polynomial to multiply. Each coefficient must be less than
+/// the modulus
+/// \param[in] coeff_count Number of coefficients in the polynomial
+/// \param[in] scalar Value with which to multiply. Must be less than the
+/// modulus
+/// \param[in] modulus Modulus with which to reduce each sum
+/// \param[in,out] acc Accumulator. Each coefficient must be less than the
+/// modulus
+/// \param[in] level Instruction set extension to use
+void multiply_add_poly_scalar_coeffmod_simd(const std::uint64_t* poly,
+                                            std::size_t coeff_count,
+                                            std::uint64_t scalar,
+                                            const seal::SmallModulus& modulus,
+                                            std::uint64_t* acc,
+                                            SIMDLevel level = simd_level());
+
+/// \brief Multiplies each element of a polynomial with a scalar and adds the
+/// product to an accumulator without modular reduction, i.e. modulo 2^64. The
+/// vectorized implementations require the modulus to be less than 2^31;
+/// otherwise the scalar implementation is used
+/// \param[in] poly Polynomial to multiply. Each coefficient must be less than
+/// twice the modulus, e.g. the unreduced sum of two coefficients
+/// \param[in] coeff_count Number of coefficients in the polynomial
+/// \param[in] scalar Value with which to multiply. Must be less than the
+/// modulus
+/// \param[in] modulus Modulus of the polynomial
+/// \param[in,out] acc Accumulator
+/// \param[in] level Instruction set extension to use
+void multiply_add_poly_scalar_lazy_simd(const std::uint64_t* poly,
+                                        std::size_t coeff_count,
+                                        std::uint64_t scalar,
+                                        const seal::SmallModulus& modulus,
+                                        std::uint64_t* acc,
+                                        SIMDLevel level = simd_level());
+
+/// \brief Reduces each element of a polynomial modulo modulus. The vectorized
+/// implementations require the modulus to be less than 2^32; otherwise the
+/// scalar implementation is used
+/// \param[in] poly Polynomial to reduce. Coefficients may be any 64-bit value
+/// \param[in] coeff_count Number of coefficients in the polynomial
+/// \param[in] modulus Modulus with which to reduce each coefficient
+/// \param[out] result Stores the result. May alias poly
+/// \param[in] level Instruction set extension to use
+void reduce_poly_coeffmod_simd(const std::uint64_t* poly,
+                               std::size_t coeff_count,
+                               const seal::SmallModulus& modulus,
+                               std::uint64_t* result,
+                               SIMDLevel level = simd_level());
+
+}  // namespace ngraph::runtime::he
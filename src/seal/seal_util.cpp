@@ -18,8 +18,10 @@
 
 #include "seal/seal_util.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <limits>
+#include <sstream>
 #include <utility>
 
 #ifdef NGRAPH_HE_ABY_ENABLE
@@ -160,19 +162,84 @@ void multiply_plain_lazy_mod(const seal::Ciphertext& encrypted, double value,
 
   for (size_t i = 0; i < encrypted_ntt_size; i++) {
     for (size_t j = 0; j < coeff_mod_count; j++) {
-      std::uint64_t scalar = plaintext_vals[j];
-#pragma omp simd
-      for (size_t k = 0; k < coeff_count; k++) {
-        *dest = *src * scalar;
-        ++src;
-        ++dest;
-      }
+      multiply_poly_scalar_lazy_simd(src, coeff_count, plaintext_vals[j],
+                                     coeff_modulus[j], dest);
+      src += coeff_count;
+      dest += coeff_count;
     }
   }
   // Set the scale
   destination.scale() = new_scale;
 }
 
+namespace {
+void fma_plain_inplace_impl(seal::Ciphertext& acc,
+                            const seal::Ciphertext& encrypted, double value,
+                            const HESealBackend& he_seal_backend,
+                            const seal::MemoryPoolHandle& pool,
+                            bool lazy_mod) {
+  auto context = he_seal_backend.get_context();
+  NGRAPH_CHECK(acc.parms_id() == encrypted.parms_id(),
+               "Accumulator parms_id does not match ciphertext parms_id");
+  NGRAPH_CHECK(acc.is_ntt_form() && encrypted.is_ntt_form(),
+               "Accumulator and ciphertext must be in NTT form");
+  const double product_scale = encrypted.scale() * encrypted.scale();
+  NGRAPH_CHECK(acc.scale() / product_scale <= 1.05 &&
+                   product_scale / acc.scale() <= 1.05,
+               "Accumulator scale ", acc.scale(),
+               " does not match product scale ", product_scale);
+
+  // Extract encryption parameters.
+  auto& context_data = *context->get_context_data(encrypted.parms_id());
+  auto& parms = context_data.parms();
+  auto& coeff_modulus = parms.coeff_modulus();
+  size_t coeff_count = parms.poly_modulus_degree();
+  size_t coeff_mod_count = coeff_modulus.size();
+  size_t encrypted_size = encrypted.size();
+  size_t acc_size = acc.size();
+
+  if (acc_size < encrypted_size) {
+    acc.resize(context, acc.parms_id(), encrypted_size);
+    std::fill_n(acc.data(acc_size),
+                (encrypted_size - acc_size) * coeff_mod_count * coeff_count,
+                0);
+  }
+
+  std::vector<std::uint64_t> plaintext_vals(coeff_mod_count, 0);
+  encode(value, element::f32, encrypted.scale(), encrypted.parms_id(),
+         plaintext_vals, he_seal_backend, pool);
+
+  for (size_t i = 0; i < encrypted_size; i++) {
+    for (size_t j = 0; j < coeff_mod_count; j++) {
+      const std::uint64_t* src = encrypted.data(i) + (j * coeff_count);
+      std::uint64_t* dest = acc.data(i) + (j * coeff_count);
+      if (lazy_mod) {
+        multiply_add_poly_scalar_lazy_simd(src, coeff_count, plaintext_vals[j],
+                                           coeff_modulus[j], dest);
+      } else {
+        multiply_add_poly_scalar_coeffmod_simd(
+            src, coeff_count, plaintext_vals[j], coeff_modulus[j], dest);
+      }
+    }
+  }
+}
+}  // namespace
+
+void fma_plain_inplace(seal::Ciphertext& acc,
+                       const seal::Ciphertext& encrypted, double value,
+                       const HESealBackend& he_seal_backend,
+                       const seal::MemoryPoolHandle& pool) {
+  fma_plain_inplace_impl(acc, encrypted, value, he_seal_backend, pool, false);
+}
+
+void fma_plain_lazy_mod_inplace(seal::Ciphertext& acc,
+                                const seal::Ciphertext& encrypted,
+                                double value,
+                                const HESealBackend& he_seal_backend,
+                                const seal::MemoryPoolHandle& pool) {
+  fma_plain_inplace_impl(acc, encrypted, value, he_seal_backend, pool, true);
+}
+
 void multiply_plain_inplace(seal::Ciphertext& encrypted, double value,
                             const HESealBackend& he_seal_backend,
                             const seal::MemoryPoolHandle& pool) {
@@ -221,50 +288,16 @@ void multiply_plain_inplace(seal::Ciphertext& encrypted, double value,
   for (size_t i = 0; i < encrypted_ntt_size; i++) {
     for (size_t j = 0; j < coeff_mod_count; j++) {
       // Multiply by scalar instead of doing dyadic product
-      if (coeff_modulus[j].value() < (1UL << 31U)) {
-        multiply_poly_scalar_coeffmod64(encrypted.data(i) + (j * coeff_count),
-                                        coeff_count, plaintext_vals[j],
-                                        coeff_modulus[j],
-                                        encrypted.data(i) + (j * coeff_count));
-      } else {
-        seal::util::multiply_poly_scalar_coeffmod(
-            encrypted.data(i) + (j * coeff_count), coeff_count,
-            plaintext_vals[j], coeff_modulus[j],
-            encrypted.data(i) + (j * coeff_count));
-      }
+      multiply_poly_scalar_coeffmod_simd(
+          encrypted.data(i) + (j * coeff_count), coeff_count,
+          plaintext_vals[j], coeff_modulus[j],
+          encrypted.data(i) + (j * coeff_count));
     }
   }
   // Set the scale
   encrypted.scale() = new_scale;
 }
 
-void multiply_poly_scalar_coeffmod64(const uint64_t* poly, size_t coeff_count,
-                                     uint64_t scalar,
-                                     const seal::SmallModulus& modulus,
-                                     std::uint64_t* result) {
-  const uint64_t modulus_value = modulus.value();
-  const uint64_t const_ratio_1 = modulus.const_ratio()[1];
-
-  // NOLINTNEXTLINE
-  for (; coeff_count--; poly++, result++) {
-    // Multiplication
-    auto z = *poly * scalar;
-
-    // Barrett base 2^64 reduction
-    // NOLINTNEXTLINE(runtime/int)
-    unsigned long long carry;
-    // Carry will store the result modulo 2^64
-    seal::util::multiply_uint64_hw64(z, const_ratio_1, &carry);
-    // Barrett subtraction
-    carry = z - carry * modulus_value;
-    // Possible correction term
-    *result =
-        carry -
-        (modulus_value &
-         static_cast<uint64_t>(-static_cast<int64_t>(carry >= modulus_value)));
-  }
-}
-
 size_t match_to_smallest_chain_index(std::vector<HEType>& he_types,
                                      const HESealBackend& he_seal_backend) {
   size_t num_elements = he_types.size();
@@ -308,6 +341,26 @@ size_t match_to_smallest_chain_index(std::vector<HEType>& he_types,
   return smallest_chain_ind.second;
 }
 
+void mod_switch_to_lowest(std::vector<HEType>& he_types,
+                          const HESealBackend& he_seal_backend) {
+  auto last_parms_id = he_seal_backend.get_context()->last_parms_id();
+  size_t num_elements = he_types.size();
+
+#pragma omp parallel for
+  for (size_t idx = 0; idx < num_elements; ++idx) {
+    auto& he_type = he_types[idx];
+    if (!he_type.is_ciphertext() ||
+        he_type.get_ciphertext()->ciphertext().parms_id() == last_parms_id) {
+      continue;
+    }
+    auto switched = HESealBackend::create_empty_ciphertext();
+    he_seal_backend.get_evaluator()->mod_switch_to(
+        he_type.get_ciphertext()->ciphertext(), last_parms_id,
+        switched->ciphertext());
+    he_type.set_ciphertext(switched);
+  }
+}
+
 void encode(double value, const element::Type& element_type, double scale,
             seal::parms_id_type parms_id,
             std::vector<std::uint64_t>& destination,
@@ -545,6 +598,34 @@ void encrypt(std::shared_ptr<SealCiphertextWrapper>& output,
   encryptor.encrypt(plaintext.plaintext(), output->ciphertext());
 }
 
+void encrypt(std::shared_ptr<SealCiphertextWrapper>& output,
+             const HEPlaintext& input, seal::parms_id_type parms_id,
+             const element::Type& element_type, double scale,
+             seal::CKKSEncoder& ckks_encoder,
+             SealZeroEncryptionPool& zero_pool, bool complex_packing) {
+  auto plaintext = SealPlaintextWrapper(complex_packing);
+
+  encode(plaintext, input, ckks_encoder, parms_id, element_type, scale,
+         complex_packing);
+  zero_pool.encrypt(plaintext.plaintext(), output->ciphertext());
+}
+
+void encrypt_symmetric_save(std::string& output, const HEPlaintext& input,
+                            seal::parms_id_type parms_id,
+                            const element::Type& element_type, double scale,
+                            seal::CKKSEncoder& ckks_encoder,
+                            const seal::Encryptor& encryptor,
+                            bool complex_packing,
+                            seal::compr_mode_type compr_mode) {
+  auto plaintext = SealPlaintextWrapper(complex_packing);
+
+  encode(plaintext, input, ckks_encoder, parms_id, element_type, scale,
+         complex_packing);
+  std::stringstream stream;
+  encryptor.encrypt_symmetric_save(plaintext.plaintext(), stream, compr_mode);
+  output = stream.str();
+}
+
 void decode(HEPlaintext& output, const SealPlaintextWrapper& input,
             seal::CKKSEncoder& ckks_encoder, size_t batch_size,
             double mod_interval) {
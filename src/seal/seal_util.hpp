@@ -26,6 +26,8 @@
 #include "ngraph/check.hpp"
 #include "seal/he_seal_backend.hpp"
 #include "seal/seal.h"
+#include "seal/seal_simd.hpp"
+#include "seal/seal_zero_encryption_pool.hpp"
 
 namespace ngraph::runtime::he {
 class SealCiphertextWrapper;
@@ -47,6 +49,15 @@ seal::sec_level_type seal_security_level(size_t bits);
 size_t match_to_smallest_chain_index(std::vector<HEType>& he_types,
                                      const HESealBackend& he_seal_backend);
 
+/// \brief Switches each ciphertext to the lowest level of the context, so it
+/// serializes to the fewest bytes. Only suitable for ciphertexts which will
+/// only be decrypted
+/// \param[in,out] he_types Vector of HE data. Each ciphertext is replaced by
+/// a switched copy, so ciphertexts shared with other tensors are unchanged
+/// \param[in] he_seal_backend Backend whose context and evaluator are used
+void mod_switch_to_lowest(std::vector<HEType>& he_types,
+                          const HESealBackend& he_seal_backend);
+
 /// \brief Returns whether or not two cipher/plaintexts have a similar scale
 /// \param[in] arg0 Ciphertext or plaintext
 /// \param[in] arg1 Ciphertext or plaintext
@@ -109,19 +120,6 @@ inline void add_plain(const seal::Ciphertext& encrypted, double value,
   add_plain_inplace(destination, value, he_seal_backend);
 }
 
-/// \brief Multiples each element in a polynomial with a scalar modulo
-/// modulus_value. Assumes the scalar, poly, and modulus value are all < 30
-/// bits
-/// \param[in] poly Polynomial to be multiplied
-/// \param[in] coeff_count Number of terms in the polynomial
-/// \param[in] scalar Value with which to multiply
-/// \param[in] modulus modulus with which to reduce each product
-/// \param[out] result Will store the result of the multiplication
-void multiply_poly_scalar_coeffmod64(const uint64_t* poly, size_t coeff_count,
-                                     uint64_t scalar,
-                                     const seal::SmallModulus& modulus,
-                                     uint64_t* result);
-
 /// \brief Adds each element in a polynomial with a scalar modulo
 /// modulus_value.
 /// \param[in] poly Polynomial to be multiplied
@@ -134,8 +132,8 @@ inline void add_poly_scalar_coeffmod(const std::uint64_t* poly,
                                      std::uint64_t scalar,
                                      const seal::SmallModulus& modulus,
                                      std::uint64_t* result) {
-  const uint64_t modulus_value = modulus.value();
 #ifdef SEAL_DEBUG
+  const uint64_t modulus_value = modulus.value();
   if (poly == nullptr && coeff_count > 0) {
     throw ngraph_error("poly");
   }
@@ -150,20 +148,14 @@ inline void add_poly_scalar_coeffmod(const std::uint64_t* poly,
   }
 #endif
 
-  for (; coeff_count--; result++, poly++) {
-// Explicit inline
-// result[i] = add_uint_uint_mod(poly[i], scalar, modulus);
 #ifdef SEAL_DEBUG
-    if (*poly >= modulus_value) {
+  for (size_t k = 0; k < coeff_count; ++k) {
+    if (poly[k] >= modulus_value) {
       throw ngraph_error("poly > modulus_value");
     }
-
-#endif
-    std::uint64_t sum = *poly + scalar;
-    *result = sum - (modulus_value &
-                     static_cast<std::uint64_t>(
-                         -static_cast<std::int64_t>(sum >= modulus_value)));
   }
+#endif
+  add_poly_scalar_coeffmod_simd(poly, coeff_count, scalar, modulus, result);
 }
 
 /// \brief Multiplies a ciphertext with a scalar in every slot
@@ -197,6 +189,39 @@ void multiply_plain_lazy_mod(
     seal::Ciphertext& destination, const HESealBackend& he_seal_backend,
     seal::MemoryPoolHandle pool = seal::MemoryManager::GetPool());
 
+/// \brief Multiplies a ciphertext with a scalar in every slot and adds the
+/// product to an accumulator, i.e. acc += encrypted * value. Streams over the
+/// ciphertext once and updates the accumulator in place, without allocating a
+/// temporary product ciphertext
+/// \param[in,out] acc Accumulator ciphertext. Must be at the same level as
+/// encrypted, and have scale similar to the square of encrypted's scale
+/// \param[in] encrypted Ciphertext to multiply
+/// \param[in] value Value to multiply the ciphertext by
+/// \param[in] he_seal_backend Backend whose context is used for encoding and
+/// multiplication
+/// \param[in] pool Memory pool used for new memory allocation
+/// \throws ngraph_error if acc and encrypted are incompatible
+void fma_plain_inplace(
+    seal::Ciphertext& acc, const seal::Ciphertext& encrypted, double value,
+    const HESealBackend& he_seal_backend,
+    const seal::MemoryPoolHandle& pool = seal::MemoryManager::GetPool());
+
+/// \brief Same as fma_plain_inplace, but skips the modulus reduction, as in
+/// multiply_plain_lazy_mod. The accumulator must be mod-reduced before it is
+/// used in any non-lazy operation
+/// \param[in,out] acc Accumulator ciphertext. Must be at the same level as
+/// encrypted, and have scale similar to the square of encrypted's scale
+/// \param[in] encrypted Ciphertext to multiply
+/// \param[in] value Value to multiply the ciphertext by
+/// \param[in] he_seal_backend Backend whose context is used for encoding and
+/// multiplication
+/// \param[in] pool Memory pool used for new memory allocation
+/// \throws ngraph_error if acc and encrypted are incompatible
+void fma_plain_lazy_mod_inplace(
+    seal::Ciphertext& acc, const seal::Ciphertext& encrypted, double value,
+    const HESealBackend& he_seal_backend,
+    const seal::MemoryPoolHandle& pool = seal::MemoryManager::GetPool());
+
 void mult_kernel(std::uint64_t* poly, uint64_t i, uint64_t scalar);
 
 /// \brief Optimized encoding of single value into vector of coefficients
@@ -243,6 +268,45 @@ void encrypt(std::shared_ptr<SealCiphertextWrapper>& output,
              seal::CKKSEncoder& ckks_encoder, const seal::Encryptor& encryptor,
              bool complex_packing);
 
+/// \brief Encrypt plaintext into ciphertext using a precomputed encryption of
+/// zero
+/// \param[out] output Encrypted value
+/// \param[in] input Plaintext to encode
+/// \param[in] parms_id Seal parameter id to use in encoding
+/// \param[in] element_type Datatype used for encoding
+/// \param[in] scale Scale at which to encode value
+/// \param[in] ckks_encoder Used for encoding
+/// \param[in] zero_pool Pool of encryptions of zero used for encrypting
+/// \param[in] complex_packing Whether or not to use complex packing during
+/// encoding
+void encrypt(std::shared_ptr<SealCiphertextWrapper>& output,
+             const HEPlaintext& input, seal::parms_id_type parms_id,
+             const element::Type& element_type, double scale,
+             seal::CKKSEncoder& ckks_encoder,
+             SealZeroEncryptionPool& zero_pool, bool complex_packing);
+
+/// \brief Encrypt plaintext with the secret key and serialize the ciphertext.
+/// The second ciphertext polynomial is replaced by the seed of the PRNG which
+/// sampled it, roughly halving the serialized size. Loading the ciphertext
+/// expands the seed
+/// \param[out] output Serialized ciphertext
+/// \param[in] input Plaintext to encode
+/// \param[in] parms_id Seal parameter id to use in encoding
+/// \param[in] element_type Datatype used for encoding
+/// \param[in] scale Scale at which to encode value
+/// \param[in] ckks_encoder Used for encoding
+/// \param[in] encryptor Used for encrypting. Must hold the secret key
+/// \param[in] complex_packing Whether or not to use complex packing during
+/// encoding
+/// \param[in] compr_mode Compression mode used to serialize
+void encrypt_symmetric_save(std::string& output, const HEPlaintext& input,
+                            seal::parms_id_type parms_id,
+                            const element::Type& element_type, double scale,
+                            seal::CKKSEncoder& ckks_encoder,
+                            const seal::Encryptor& encryptor,
+                            bool complex_packing,
+                            seal::compr_mode_type compr_mode);
+
 /// \brief Decode SEAL plaintext into plaintext values
 /// \param[out] output Decoded values
 /// \param[in] input Plaintext to decode
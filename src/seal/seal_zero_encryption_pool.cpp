@@ -0,0 +1,144 @@
+//*****************************************************************************
+// Copyright 2018-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "seal/seal_zero_encryption_pool.hpp"
+
+#include <utility>
+
+#include "logging/ngraph_he_log.hpp"
+#include "ngraph/check.hpp"
+#include "seal/util/polyarithsmallmod.h"
+
+namespace ngraph::runtime::he {
+
+SealZeroEncryptionPool::SealZeroEncryptionPool(
+    std::shared_ptr<seal::SEALContext> context,
+    const seal::Encryptor& encryptor, seal::parms_id_type parms_id,
+    size_t capacity, size_t num_threads)
+    : m_context(std::move(context)),
+      m_encryptor(encryptor),
+      m_parms_id(parms_id),
+      m_capacity(capacity) {
+  NGRAPH_CHECK(m_context->get_context_data(m_parms_id) != nullptr,
+               "parms_id not valid for encryption parameters");
+  if (m_capacity == 0) {
+    return;
+  }
+  NGRAPH_HE_LOG(3) << "Precomputing " << m_capacity
+                   << " encryptions of zero with " << num_threads
+                   << " threads";
+  m_threads.reserve(num_threads);
+  for (size_t i = 0; i < num_threads; ++i) {
+    m_threads.emplace_back([this]() { fill(); });
+  }
+}
+
+SealZeroEncryptionPool::~SealZeroEncryptionPool() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_fill_cond.notify_all();
+  for (auto& thread : m_threads) {
+    thread.join();
+  }
+}
+
+void SealZeroEncryptionPool::fill() {
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_fill_cond.wait(lock, [this]() {
+        return m_stop || m_zeros.size() + m_pending_count < m_capacity;
+      });
+      if (m_stop) {
+        return;
+      }
+      m_pending_count++;
+    }
+
+    seal::Ciphertext zero;
+    m_encryptor.encrypt_zero(m_parms_id, zero);
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_pending_count--;
+      m_zeros.emplace_back(std::move(zero));
+      if (m_zeros.size() == m_capacity) {
+        m_full_cond.notify_all();
+      }
+    }
+  }
+}
+
+void SealZeroEncryptionPool::get(seal::Ciphertext& destination) {
+  seal::Ciphertext zero;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_zeros.empty()) {
+      m_miss_count++;
+    } else {
+      zero = std::move(m_zeros.front());
+      m_zeros.pop_front();
+      m_fill_cond.notify_one();
+    }
+  }
+  if (zero.size() == 0) {
+    m_encryptor.encrypt_zero(m_parms_id, destination);
+  } else {
+    // Copy, rather than move, so destination keeps its memory pool
+    destination = zero;
+  }
+}
+
+void SealZeroEncryptionPool::encrypt(const seal::Plaintext& plain,
+                                     seal::Ciphertext& destination) {
+  if (plain.parms_id() != m_parms_id) {
+    m_encryptor.encrypt(plain, destination);
+    return;
+  }
+  NGRAPH_CHECK(plain.is_ntt_form(), "Plaintext is not in NTT form");
+
+  get(destination);
+
+  // Add the plaintext to the first polynomial, as SEAL's CKKS encryption does
+  const auto& parms = m_context->get_context_data(m_parms_id)->parms();
+  const auto& coeff_modulus = parms.coeff_modulus();
+  size_t coeff_count = parms.poly_modulus_degree();
+  for (size_t i = 0; i < coeff_modulus.size(); ++i) {
+    seal::util::add_poly_poly_coeffmod(
+        destination.data() + i * coeff_count, plain.data() + i * coeff_count,
+        coeff_count, coeff_modulus[i], destination.data() + i * coeff_count);
+  }
+  destination.scale() = plain.scale();
+}
+
+void SealZeroEncryptionPool::wait_until_full() {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_full_cond.wait(lock, [this]() { return m_zeros.size() >= m_capacity; });
+}
+
+size_t SealZeroEncryptionPool::size() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_zeros.size();
+}
+
+size_t SealZeroEncryptionPool::miss_count() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_miss_count;
+}
+
+}  // namespace ngraph::runtime::he
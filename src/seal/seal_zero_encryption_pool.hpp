@@ -0,0 +1,99 @@
+//*****************************************************************************
+// Copyright 2018-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "seal/seal.h"
+
+namespace ngraph::runtime::he {
+/// \brief Pool of public-key encryptions of zero, precomputed by background
+/// threads. Public-key encryption of a plaintext is an encryption of zero plus
+/// the plaintext, so taking the expensive encryption of zero from the pool
+/// leaves only a polynomial addition on the critical path. Each encryption of
+/// zero is handed out at most once.
+class SealZeroEncryptionPool {
+ public:
+  /// \brief Creates the pool and starts the background threads
+  /// \param[in] context SEAL context storing the encryption parameters
+  /// \param[in] encryptor Public-key encryptor used to encrypt zero. Must
+  /// outlive the pool
+  /// \param[in] parms_id Parameter id at which to encrypt zero
+  /// \param[in] capacity Maximum number of precomputed encryptions of zero
+  /// \param[in] num_threads Number of background threads
+  SealZeroEncryptionPool(std::shared_ptr<seal::SEALContext> context,
+                         const seal::Encryptor& encryptor,
+                         seal::parms_id_type parms_id, size_t capacity,
+                         size_t num_threads = 1);
+
+  /// \brief Stops the background threads
+  ~SealZeroEncryptionPool();
+
+  SealZeroEncryptionPool(const SealZeroEncryptionPool&) = delete;
+  SealZeroEncryptionPool& operator=(const SealZeroEncryptionPool&) = delete;
+
+  /// \brief Encrypts a plaintext using a precomputed encryption of zero.
+  /// Plaintexts not at the pool's parms_id are encrypted directly
+  /// \param[in] plain Plaintext to encrypt, in NTT form
+  /// \param[out] destination Encryption of plain
+  void encrypt(const seal::Plaintext& plain, seal::Ciphertext& destination);
+
+  /// \brief Takes an encryption of zero from the pool. If the pool is empty,
+  /// encrypts zero on the calling thread
+  /// \param[out] destination Encryption of zero
+  void get(seal::Ciphertext& destination);
+
+  /// \brief Blocks until the pool is full
+  void wait_until_full();
+
+  /// \brief Returns the number of precomputed encryptions of zero available
+  size_t size() const;
+
+  /// \brief Returns the maximum number of precomputed encryptions of zero
+  size_t capacity() const { return m_capacity; }
+
+  /// \brief Returns the parameter id of the encryptions of zero
+  const seal::parms_id_type& parms_id() const { return m_parms_id; }
+
+  /// \brief Returns the number of encryptions of zero computed on the calling
+  /// thread because the pool was empty
+  size_t miss_count() const;
+
+ private:
+  void fill();
+
+  std::shared_ptr<seal::SEALContext> m_context;
+  const seal::Encryptor& m_encryptor;
+  seal::parms_id_type m_parms_id;
+  size_t m_capacity;
+
+  std::deque<seal::Ciphertext> m_zeros;
+  size_t m_pending_count{0};
+  size_t m_miss_count{0};
+  bool m_stop{false};
+  mutable std::mutex m_mutex;
+  std::condition_variable m_fill_cond;
+  std::condition_variable m_full_cond;
+  std::vector<std::thread> m_threads;
+};
+}  // namespace ngraph::runtime::he
@@ -0,0 +1,107 @@
+//*****************************************************************************
+// Copyright 2018-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "tcp/round_trip_batcher.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+#include "ngraph/check.hpp"
+
+namespace ngraph::runtime::he {
+RoundTripBatcher::RoundTripBatcher(size_t max_batch_byte_count,
+                                   size_t max_in_flight_count)
+    : m_max_batch_byte_count(std::max(size_t(1), max_batch_byte_count)),
+      m_max_in_flight_count(std::max(size_t(1), max_in_flight_count)),
+      m_batch_byte_count(
+          std::min(initial_batch_byte_count, m_max_batch_byte_count)) {}
+
+size_t RoundTripBatcher::batch_size(size_t element_byte_count) const {
+  NGRAPH_CHECK(element_byte_count > 0, "Element byte count must be positive");
+  return std::max(size_t(1), m_batch_byte_count / element_byte_count);
+}
+
+void RoundTripBatcher::start_batch(size_t element_count, size_t byte_count,
+                                   clock::time_point now) {
+  NGRAPH_CHECK(can_start_batch(), "Too many batches in flight");
+  bool started_idle = m_in_flight.empty();
+  if (started_idle) {
+    // The round-trip was idle, which does not count towards delivery
+    m_last_finish_time = now;
+  }
+  m_in_flight.push_back(
+      InFlightBatch{element_count, byte_count, now, started_idle});
+}
+
+void RoundTripBatcher::finish_batch(clock::time_point now) {
+  NGRAPH_CHECK(!m_in_flight.empty(), "No batch in flight");
+  InFlightBatch batch = m_in_flight.front();
+  m_in_flight.pop_front();
+
+  // The batch was delivered in the time since the previous result, or since
+  // it was started if the round-trip was idle before
+  auto delivery_time = std::chrono::duration<double>(
+      now - std::max(m_last_finish_time, batch.start_time));
+  m_last_finish_time = now;
+  double delivery_rate =
+      batch.byte_count / std::max(delivery_time.count(), 1e-6);
+
+  auto latency = now - batch.start_time;
+  if (batch.started_idle) {
+    // Latency of batches queued behind others includes the queueing
+    m_idle_latency = latency;
+    m_idle_byte_count = batch.byte_count;
+  }
+  m_metrics.push_back(BatchMetrics{
+      batch.element_count, batch.byte_count,
+      std::chrono::duration_cast<std::chrono::microseconds>(latency),
+      delivery_rate});
+  if (m_metrics.size() > metrics_window) {
+    m_metrics.pop_front();
+  }
+  update_batch_byte_count();
+}
+
+void RoundTripBatcher::update_batch_byte_count() {
+  if (m_max_in_flight_count <= 2) {
+    // Too few batches overlap to cover the round-trip, so only its overhead
+    // is amortized
+    m_batch_byte_count = m_max_batch_byte_count;
+    return;
+  }
+
+  auto window_begin =
+      m_metrics.end() - std::min(m_metrics.size(), delivery_rate_window);
+  double bandwidth =
+      std::max_element(window_begin, m_metrics.end(),
+                       [](const BatchMetrics& a, const BatchMetrics& b) {
+                         return a.delivery_rate < b.delivery_rate;
+                       })
+          ->delivery_rate;
+  double delay = std::max(
+      0.0, m_idle_latency.count() - m_idle_byte_count / bandwidth);
+
+  // One batch in flight is being delivered and one is being processed, so
+  // the others cover the delay
+  auto target =
+      static_cast<size_t>(bandwidth * delay / (m_max_in_flight_count - 2));
+  // Change gradually, since one sample may be an outlier
+  target = std::clamp(target, m_batch_byte_count / 2, m_batch_byte_count * 2);
+  m_batch_byte_count =
+      std::clamp(target, std::min(min_batch_byte_count, m_max_batch_byte_count),
+                 m_max_batch_byte_count);
+}
+}  // namespace ngraph::runtime::he
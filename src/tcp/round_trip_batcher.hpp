@@ -0,0 +1,120 @@
+//*****************************************************************************
+// Copyright 2018-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <chrono>
+#include <deque>
+
+namespace ngraph::runtime::he {
+/// \brief Class sizing the batches of a client round-trip, such as ReLU
+/// requests. Batches are sized in bytes, so that the batches in flight cover
+/// the bandwidth-delay product of the round-trip. The bandwidth is the largest
+/// recent delivery rate. The delay is the latency of the latest batch started
+/// while no other batch was in flight, less the time to deliver its bytes.
+/// Results are expected in the order batches are started. Not thread-safe
+class RoundTripBatcher {
+ public:
+  using clock = std::chrono::steady_clock;
+
+  /// \brief Measurements of a completed batch
+  struct BatchMetrics {
+    size_t element_count;
+    size_t byte_count;
+    /// Time from starting the batch until its result was received
+    std::chrono::microseconds latency;
+    /// Bytes per second delivered by the round-trip while the batch was
+    /// the oldest in flight
+    double delivery_rate;
+  };
+
+  /// \brief Byte count of the first batches, before any round-trip is
+  /// measured
+  static constexpr size_t initial_batch_byte_count = 1UL << 22;
+
+  /// \brief Smallest batch byte count chosen
+  static constexpr size_t min_batch_byte_count = 1UL << 16;
+
+  /// \brief Number of recent batches over which the largest delivery rate
+  /// is taken
+  static constexpr size_t delivery_rate_window = 16;
+
+  /// \brief Number of recent batches whose measurements are kept, so a
+  /// long-running server holds bounded measurements
+  static constexpr size_t metrics_window = 1024;
+
+  /// \brief Constructs a batcher
+  /// \param[in] max_batch_byte_count Largest batch byte count chosen
+  /// \param[in] max_in_flight_count Number of batches which may be in flight
+  /// at once, so the client processes one batch while the next is written
+  explicit RoundTripBatcher(size_t max_batch_byte_count,
+                            size_t max_in_flight_count = 4);
+
+  /// \brief Returns the number of elements in the next batch, which is at
+  /// least one
+  /// \param[in] element_byte_count Serialized size of each element
+  size_t batch_size(size_t element_byte_count) const;
+
+  /// \brief Returns the byte count targeted by the next batch
+  size_t batch_byte_count() const { return m_batch_byte_count; }
+
+  /// \brief Returns whether or not another batch may be started without
+  /// exceeding the number of batches in flight
+  bool can_start_batch() const {
+    return m_in_flight.size() < m_max_in_flight_count;
+  }
+
+  /// \brief Returns the number of batches started but not finished
+  size_t in_flight_count() const { return m_in_flight.size(); }
+
+  /// \brief Records that a batch was sent
+  /// \param[in] element_count Number of elements in the batch
+  /// \param[in] byte_count Serialized size of the batch
+  /// \param[in] now Time at which the batch was started
+  void start_batch(size_t element_count, size_t byte_count,
+                   clock::time_point now = clock::now());
+
+  /// \brief Records the result of the oldest batch in flight, and resizes
+  /// the following batches
+  /// \param[in] now Time at which the result was received
+  void finish_batch(clock::time_point now = clock::now());
+
+  /// \brief Returns the measurements of the most recent finished batches, at
+  /// most metrics_window, in order
+  const std::deque<BatchMetrics>& metrics() const { return m_metrics; }
+
+ private:
+  struct InFlightBatch {
+    size_t element_count;
+    size_t byte_count;
+    clock::time_point start_time;
+    bool started_idle;
+  };
+
+  void update_batch_byte_count();
+
+  size_t m_max_batch_byte_count;
+  size_t m_max_in_flight_count;
+  size_t m_batch_byte_count;
+
+  std::deque<InFlightBatch> m_in_flight;
+  clock::time_point m_last_finish_time;
+  // Latest batch started while no other batch was in flight
+  std::chrono::duration<double> m_idle_latency{0};
+  size_t m_idle_byte_count{0};
+  std::deque<BatchMetrics> m_metrics;
+};
+}  // namespace ngraph::runtime::he
@@ -17,61 +17,84 @@
 #include "tcp/tcp_client.hpp"
 
 #include <chrono>
-#include <deque>
 #include <memory>
 #include <string>
 #include <thread>
 #include <utility>
+#include <vector>
 
 #include "boost/asio.hpp"
 #include "logging/ngraph_he_log.hpp"
 #include "ngraph/check.hpp"
 #include "tcp/tcp_message.hpp"
+#include "tcp/tcp_message_dispatcher.hpp"
+#include "tcp/tcp_transport.hpp"
 
 namespace ngraph::runtime::he {
 
 const char* TCPClient::s_expected_teardown_message = "End of file";
 
+bool TCPClient::is_teardown(const boost::system::error_code& ec) {
+  // Reads pending when the client closes its socket are aborted
+  return ec.message() == s_expected_teardown_message ||
+         ec == boost::asio::error::operation_aborted;
+}
+
 TCPClient::TCPClient(
     boost::asio::io_context& io_context,
-    const boost::asio::ip::tcp::resolver::results_type& endpoints,
+    const std::vector<stream_endpoint>& endpoints,
     const std::function<void(const TCPMessage&)>& message_handler)
+    : TCPClient(io_context, endpoints,
+                std::make_shared<TCPMessageDispatcher>(message_handler)) {}
+
+TCPClient::TCPClient(
+    boost::asio::io_context& io_context,
+    const std::vector<stream_endpoint>& endpoints,
+    std::shared_ptr<TCPMessageDispatcher> dispatcher)
     : m_io_context(io_context),
       m_socket(io_context),
-      m_message_callback(std::bind(message_handler, std::placeholders::_1)) {
+      m_write_queue(std::make_shared<TCPWriteQueue>(
+          m_socket,
+          [](const boost::system::error_code& ec) {
+            NGRAPH_ERR << "Client error writing message: " << ec.message();
+          })),
+      m_dispatcher(std::move(dispatcher)) {
   do_connect(endpoints);
 }
 
 /// \brief Closes the socket
 void TCPClient::close() {
   NGRAPH_HE_LOG(1) << "Closing socket";
-  m_socket.shutdown(boost::asio::ip::tcp::socket::shutdown_both);
-  boost::asio::post(m_io_context, [this]() { m_socket.close(); });
+  // Handlers call close off the io thread, so the socket is closed on it
+  boost::asio::post(m_io_context, [this]() {
+    m_socket.shutdown(stream_socket::shutdown_both);
+    m_socket.close();
+  });
 }
 
 /// \brief Asynchronously writes the message
 /// \param[in,out] message Message to write
 void TCPClient::write_message(TCPMessage&& message) {
-  bool write_in_progress = !m_message_queue.empty();
-  m_message_queue.push_back(std::move(message));
-  if (!write_in_progress) {
-    boost::asio::post(m_io_context, [this]() { do_write(); });
-  }
+  m_write_queue->push(std::move(message));
 }
 
 void TCPClient::do_connect(
-    const boost::asio::ip::tcp::resolver::results_type& endpoints,
+    const std::vector<stream_endpoint>& endpoints,
     size_t delay_ms) {
   NGRAPH_HE_LOG(1) << "Trying to connect TCP client";
   boost::asio::async_connect(
       m_socket, endpoints,
       [this, delay_ms, &endpoints](
           const boost::system::error_code& ec,
-          const boost::asio::ip::tcp::endpoint& connect_endpoint) {
+          const stream_endpoint& connect_endpoint) {
         static_cast<void>(connect_endpoint);  // Avoid unused-parameter warning
         if (!ec) {
           NGRAPH_HE_LOG(1) << "Connected to server";
+          m_connected = true;
           do_read_header();
+        } else if (ec == boost::asio::error::operation_aborted) {
+          // The client closed before the connection was established
+          NGRAPH_HE_LOG(1) << "Connection attempt aborted";
         } else {
           NGRAPH_INFO << "error connecting to server: " << ec.message();
           std::this_thread::sleep_for(std::chrono::milliseconds(delay_ms));
@@ -86,52 +109,59 @@ void TCPClient::do_connect(
 }
 
 void TCPClient::do_read_header() {
-  if (m_read_buffer.size() < header_length) {
-    m_read_buffer.resize(header_length);
-  }
+  m_read_buffer = m_dispatcher->acquire_buffer();
+  m_read_buffer.resize(header_length);
   boost::asio::async_read(
       m_socket, boost::asio::buffer(&m_read_buffer[0], header_length),
       [this](boost::system::error_code ec, std::size_t /* length */) {
-        NGRAPH_CHECK(!ec || ec.message() == s_expected_teardown_message,
+        NGRAPH_CHECK(!ec || is_teardown(ec),
                      "Client error reading message header: ", ec.message());
         if (!ec) {
           size_t msg_len = TCPMessage::decode_header(m_read_buffer);
-          do_read_body(msg_len);
+          size_t payload_len = TCPMessage::decode_payload_header(m_read_buffer);
+          do_read_body(msg_len, payload_len);
         }
       });
 }
 
-void TCPClient::do_read_body(size_t body_length) {
+void TCPClient::do_read_body(size_t body_length, size_t payload_length) {
   m_read_buffer.resize(header_length + body_length);
   boost::asio::async_read(
       m_socket, boost::asio::buffer(&m_read_buffer[header_length], body_length),
-      [this](boost::system::error_code ec, std::size_t /* length */) {
-        NGRAPH_CHECK(!ec || ec.message() == s_expected_teardown_message,
+      [this, payload_length](boost::system::error_code ec,
+                             std::size_t /* length */) {
+        NGRAPH_CHECK(!ec || is_teardown(ec),
                      "Client error reading message body: ", ec.message());
         if (!ec) {
-          m_read_message.unpack(m_read_buffer);
-          m_message_callback(m_read_message);
-          do_read_header();
+          if (payload_length > 0) {
+            // Payloads are allocated from the protobuf metadata, so it is
+            // parsed before the payloads are read
+            m_read_message = TCPMessage();
+            m_read_message.unpack(m_read_buffer);
+            m_dispatcher->release_buffer(std::move(m_read_buffer));
+            do_read_payloads(payload_length);
+          } else {
+            m_dispatcher->dispatch(std::move(m_read_buffer));
+            do_read_header();
+          }
         }
       });
 }
 
-void TCPClient::do_write() {
-  auto message = m_message_queue.front();
-  message.pack(m_write_buffer);
-  NGRAPH_HE_LOG(4) << "Client writing message size " << m_write_buffer.size()
-                   << " bytes";
+void TCPClient::do_read_payloads(size_t payload_length) {
+  auto buffers = m_read_message.allocate_payloads(m_context);
+  NGRAPH_CHECK(boost::asio::buffer_size(buffers) == payload_length,
+               "Raw payload size ", boost::asio::buffer_size(buffers),
+               " does not match header size ", payload_length);
 
-  boost::asio::async_write(
-      m_socket, boost::asio::buffer(m_write_buffer),
+  boost::asio::async_read(
+      m_socket, buffers,
       [this](boost::system::error_code ec, std::size_t /* length */) {
+        NGRAPH_CHECK(!ec || is_teardown(ec),
+                     "Client error reading message payloads: ", ec.message());
         if (!ec) {
-          m_message_queue.pop_front();
-          if (!m_message_queue.empty()) {
-            do_write();
-          }
-        } else {
-          NGRAPH_ERR << "Client error writing message: " << ec.message();
+          m_dispatcher->dispatch(std::move(m_read_message));
+          do_read_header();
         }
       });
 }
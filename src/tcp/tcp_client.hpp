@@ -16,16 +16,24 @@
 
 #pragma once
 
-#include <deque>
+#include <atomic>
+#include <functional>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "boost/asio.hpp"
 #include "logging/ngraph_he_log.hpp"
+#include "seal/seal.h"
 #include "tcp/tcp_message.hpp"
+#include "tcp/tcp_message_dispatcher.hpp"
+#include "tcp/tcp_transport.hpp"
+#include "tcp/tcp_write_queue.hpp"
 
 namespace ngraph::runtime::he {
-/// \brief Class representing a Client over a TCP connection
+/// \brief Class representing a Client over a TCP connection, or over a Unix
+/// domain socket if the server is on the same host
 class TCPClient {
  public:
   using data_buffer = TCPMessage::data_buffer;
@@ -33,39 +41,79 @@ class TCPClient {
 
   /// \brief Connects client to hostname:port and reads message
   /// \param[in] io_context Boost context for I/O functionality
-  /// \param[in] endpoints Socket to connect to
-  /// \param[in] message_handler Function to handle responses from the server
+  /// \param[in] endpoints Socket to connect to, as from resolve_endpoints.
+  /// Must outlive the connection attempt
+  /// \param[in] message_handler Function to handle responses from the server.
+  /// Messages are handled in order, off the io thread
   TCPClient(boost::asio::io_context& io_context,
-            const boost::asio::ip::tcp::resolver::results_type& endpoints,
+            const std::vector<stream_endpoint>& endpoints,
             const std::function<void(const TCPMessage&)>& message_handler);
 
+  /// \brief Connects client to hostname:port and hands responses to a
+  /// dispatcher shared with other clients. Used to stripe a transfer across
+  /// parallel connections, whose messages are then handled in a single order
+  /// \param[in] io_context Boost context for I/O functionality
+  /// \param[in] endpoints Socket to connect to. Must outlive the connection
+  /// attempt
+  /// \param[in] dispatcher Dispatcher handling responses from the server
+  TCPClient(boost::asio::io_context& io_context,
+            const std::vector<stream_endpoint>& endpoints,
+            std::shared_ptr<TCPMessageDispatcher> dispatcher);
+
   /// \brief Closes the socket
   void close();
 
-  /// \brief Asynchronously writes the message
+  /// \brief Asynchronously writes the message. Thread-safe
   /// \param[in,out] message Message to write
   void write_message(TCPMessage&& message);
 
+  /// \brief Blocks until fewer than max_queue_size messages are queued to be
+  /// written. Must not be called from the io thread
+  /// \param[in] max_queue_size Number of queued messages to wait below
+  void wait_for_write_queue(size_t max_queue_size) {
+    m_write_queue->wait_for_size(max_queue_size);
+  }
+
+  /// \brief Sets the SEAL context used to allocate ciphertexts read from raw
+  /// payloads
+  /// \param[in] context SEAL context
+  void set_context(std::shared_ptr<seal::SEALContext> context) {
+    m_context = std::move(context);
+  }
+
+  /// \brief Returns whether or not the client has connected to the server
+  bool connected() const { return m_connected; }
+
+  /// \brief Returns the dispatcher handling the client's messages
+  const std::shared_ptr<TCPMessageDispatcher>& dispatcher() const {
+    return m_dispatcher;
+  }
+
  private:
-  void do_connect(const boost::asio::ip::tcp::resolver::results_type& endpoints,
+  void do_connect(const std::vector<stream_endpoint>& endpoints,
                   size_t delay_ms = 10);
 
   void do_read_header();
 
-  void do_read_body(size_t body_length);
+  void do_read_body(size_t body_length, size_t payload_length);
 
-  void do_write();
+  void do_read_payloads(size_t payload_length);
 
   boost::asio::io_context& m_io_context;
-  boost::asio::ip::tcp::socket m_socket;
+  stream_socket m_socket;
+  std::shared_ptr<seal::SEALContext> m_context;
 
   data_buffer m_read_buffer;
-  data_buffer m_write_buffer;
   TCPMessage m_read_message;
-  std::deque<TCPMessage> m_message_queue;
+  std::shared_ptr<TCPWriteQueue> m_write_queue;
+  std::atomic<bool> m_connected{false};
 
   static const char* s_expected_teardown_message;
 
-  std::function<void(const TCPMessage&)> m_message_callback;
+  /// \brief Returns whether or not a read error is due to the connection
+  /// closing
+  static bool is_teardown(const boost::system::error_code& ec);
+
+  std::shared_ptr<TCPMessageDispatcher> m_dispatcher;
 };
 }  // namespace ngraph::runtime::he
@@ -21,10 +21,12 @@
 #include <string>
 #include <utility>
 
+#include "boost/asio.hpp"
 #include "ngraph/check.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/util.hpp"
 #include "protos/message.pb.h"
+#include "seal/seal_ciphertext_wrapper.hpp"
 
 namespace ngraph::runtime::he {
 
@@ -33,13 +35,19 @@ TCPMessage::TCPMessage() = default;
 TCPMessage::TCPMessage(pb::TCPMessage&& pb_message)
     : m_pb_message(std::make_shared<pb::TCPMessage>(std::move(pb_message))) {}
 
+TCPMessage::TCPMessage(pb::TCPMessage&& pb_message, CiphertextPayloads payloads)
+    : m_pb_message(std::make_shared<pb::TCPMessage>(std::move(pb_message))),
+      m_payloads(std::move(payloads)) {}
+
 std::shared_ptr<pb::TCPMessage> TCPMessage::pb_message() const {
   return m_pb_message;
 }
 
-void TCPMessage::encode_header(TCPMessage::data_buffer& buffer, size_t size) {
+void TCPMessage::encode_header(TCPMessage::data_buffer& buffer, size_t size,
+                               size_t payload_size) {
   NGRAPH_CHECK(buffer.size() >= TCPMessage::header_length, "Buffer too small");
-  std::memcpy(&buffer[0], &size, TCPMessage::header_length);
+  std::memcpy(&buffer[0], &size, sizeof(size_t));
+  std::memcpy(&buffer[sizeof(size_t)], &payload_size, sizeof(size_t));
 }
 
 size_t TCPMessage::decode_header(const TCPMessage::data_buffer& buffer) {
@@ -47,26 +55,90 @@ size_t TCPMessage::decode_header(const TCPMessage::data_buffer& buffer) {
     return 0;
   }
   size_t body_length = 0;
-  std::memcpy(&body_length, &buffer[0], TCPMessage::header_length);
+  std::memcpy(&body_length, &buffer[0], sizeof(size_t));
   return body_length;
 }
 
+size_t TCPMessage::decode_payload_header(
+    const TCPMessage::data_buffer& buffer) {
+  if (buffer.size() < TCPMessage::header_length) {
+    return 0;
+  }
+  size_t payload_length = 0;
+  std::memcpy(&payload_length, &buffer[sizeof(size_t)], sizeof(size_t));
+  return payload_length;
+}
+
 bool TCPMessage::pack(TCPMessage::data_buffer& buffer) {
   NGRAPH_CHECK(m_pb_message != nullptr, "Can't pack empty proto message");
   size_t msg_size = m_pb_message->ByteSize();
+  size_t payload_size = 0;
+  for (const auto& payload : m_payloads) {
+    if (payload != nullptr) {
+      payload_size += payload->byte_count();
+    }
+  }
   buffer.resize(TCPMessage::header_length + msg_size);
-  encode_header(buffer, msg_size);
+  encode_header(buffer, msg_size, payload_size);
   return m_pb_message->SerializeToArray(&buffer[TCPMessage::header_length],
                                         msg_size);
 }
 
+std::vector<boost::asio::const_buffer> TCPMessage::write_buffers(
+    const TCPMessage::data_buffer& buffer) const {
+  std::vector<boost::asio::const_buffer> buffers{boost::asio::buffer(buffer)};
+  for (const auto& payload : m_payloads) {
+    if (payload != nullptr) {
+      buffers.emplace_back(payload->ciphertext().data(), payload->byte_count());
+    }
+  }
+  return buffers;
+}
+
 bool TCPMessage::unpack(const TCPMessage::data_buffer& buffer) {
   if (!m_pb_message) {
     m_pb_message = std::make_shared<pb::TCPMessage>();
   }
+  m_payloads.clear();
   return m_pb_message->ParseFromArray(
       &buffer[TCPMessage::header_length],
       buffer.size() - TCPMessage::header_length);
 }
 
+std::vector<boost::asio::mutable_buffer> TCPMessage::allocate_payloads(
+    const std::shared_ptr<seal::SEALContext>& context) {
+  NGRAPH_CHECK(m_pb_message != nullptr, "Can't allocate for empty message");
+  NGRAPH_CHECK(context != nullptr, "Can't allocate without a SEAL context");
+  m_payloads.clear();
+
+  for (const auto& pb_tensor : m_pb_message->he_tensors()) {
+    for (const auto& pb_he_type : pb_tensor.data()) {
+      if (!pb_he_type.has_raw_ciphertext()) {
+        continue;
+      }
+      const auto& raw_cipher = pb_he_type.raw_ciphertext();
+      size_t index = raw_cipher.index();
+      NGRAPH_CHECK(index < static_cast<size_t>(pb_tensor.data_size()),
+                   "Raw ciphertext index ", index, " out of range");
+      if (index >= m_payloads.size()) {
+        m_payloads.resize(index + 1);
+      }
+      NGRAPH_CHECK(m_payloads[index] == nullptr, "Duplicate raw ciphertext ",
+                   index);
+
+      auto cipher = std::make_shared<SealCiphertextWrapper>();
+      SealCiphertextWrapper::load_metadata(*cipher, raw_cipher, context);
+      m_payloads[index] = cipher;
+    }
+  }
+
+  std::vector<boost::asio::mutable_buffer> buffers;
+  for (const auto& payload : m_payloads) {
+    if (payload != nullptr) {
+      buffers.emplace_back(payload->ciphertext().data(), payload->byte_count());
+    }
+  }
+  return buffers;
+}
+
 }  // namespace ngraph::runtime::he
@@ -19,13 +19,20 @@
 #include <memory>
 #include <vector>
 
+#include "boost/asio.hpp"
 #include "protos/message.pb.h"
+#include "seal/seal.h"
+#include "seal/seal_ciphertext_wrapper.hpp"
 
 namespace ngraph::runtime::he {
-/// \brief Represents a message. A wrapper around pb::TCPMessage
+/// \brief Class representing a message between the server and client. A
+/// message is framed as a header, storing the size of the protobuf message and
+/// the total size of the raw ciphertext payloads, followed by the protobuf
+/// message and the payloads. Raw payloads are written directly from, and read
+/// directly into, the ciphertext buffers
 class TCPMessage {
  public:
-  enum { header_length = sizeof(size_t) };
+  enum { header_length = 2 * sizeof(size_t) };
   using data_buffer = std::vector<char>;
 
   /// \brief Creates empty message
@@ -37,13 +44,25 @@ class TCPMessage {
   /// \param[in,out] pb_message Protobuf message to populate TCPMessage
   explicit TCPMessage(pb::TCPMessage&& pb_message);
 
+  /// \brief Creates message from given protobuf message and raw ciphertext
+  /// payloads
+  /// \param[in,out] pb_message Protobuf message to populate TCPMessage. Stores
+  /// the metadata of the raw ciphertexts
+  /// \param[in] payloads Ciphertexts written after the protobuf message
+  TCPMessage(pb::TCPMessage&& pb_message, CiphertextPayloads payloads);
+
   /// \brief Returns pointer to udnerlying protobuf message
   std::shared_ptr<pb::TCPMessage> pb_message() const;
 
-  /// \brief Stores a size in the buffer header
-  /// \param[in,out] buffer Buffer to write size to
-  /// \param[in] size Size to write into buffer
-  static void encode_header(data_buffer& buffer, size_t size);
+  /// \brief Returns the raw ciphertext payloads of the message
+  const CiphertextPayloads& payloads() const { return m_payloads; }
+
+  /// \brief Stores the message sizes in the buffer header
+  /// \param[in,out] buffer Buffer to write sizes to
+  /// \param[in] size Size of the protobuf message
+  /// \param[in] payload_size Total size of the raw ciphertext payloads
+  static void encode_header(data_buffer& buffer, size_t size,
+                            size_t payload_size = 0);
 
   /// \brief Given a buffer storing a message with the length in the first
   /// header_length bytes, returns the size of the stored buffer
@@ -51,18 +70,39 @@ class TCPMessage {
   /// \returns size of message stored in buffer
   static size_t decode_header(const data_buffer& buffer);
 
-  /// \brief Writes the message to a buffer
+  /// \brief Given a buffer storing a message header, returns the total size of
+  /// the raw ciphertext payloads following the protobuf message
+  /// \param[in] buffer Buffer storing a message
+  /// \returns size of raw payloads
+  static size_t decode_payload_header(const data_buffer& buffer);
+
+  /// \brief Writes the message header and protobuf message to a buffer
   /// \param[in,out] buffer Buffer to write the message to
   /// \throws ngraph_error if message is empty
   /// \returns Whether or not the operation was successful
   bool pack(data_buffer& buffer);
 
+  /// \brief Returns the buffers to write the message from, without copying
+  /// the raw payloads
+  /// \param[in] buffer Buffer storing the packed header and protobuf message
+  std::vector<boost::asio::const_buffer> write_buffers(
+      const data_buffer& buffer) const;
+
   /// \brief Writes a given buffer to the message
   /// \param[in] buffer Buffer to read the message from
   /// \returns Whether or not the operation was successful
   bool unpack(const data_buffer& buffer);
 
+  /// \brief Allocates ciphertexts for the raw payloads described by the
+  /// unpacked protobuf message
+  /// \param[in] context SEAL context to allocate ciphertexts with
+  /// \returns Buffers to read the raw payloads into, in frame order
+  /// \throws ngraph_error if the ciphertext metadata is invalid
+  std::vector<boost::asio::mutable_buffer> allocate_payloads(
+      const std::shared_ptr<seal::SEALContext>& context);
+
  private:
   std::shared_ptr<pb::TCPMessage> m_pb_message;
+  CiphertextPayloads m_payloads;
 };
 }  // namespace ngraph::runtime::he
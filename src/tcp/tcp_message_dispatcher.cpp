@@ -0,0 +1,75 @@
+//*****************************************************************************
+// Copyright 2018-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "tcp/tcp_message_dispatcher.hpp"
+
+#include <exception>
+#include <utility>
+
+#include "logging/ngraph_he_log.hpp"
+#include "ngraph/check.hpp"
+
+namespace ngraph::runtime::he {
+TCPMessageDispatcher::TCPMessageDispatcher(message_handler handler,
+                                           size_t num_threads)
+    : m_handler(std::move(handler)),
+      m_pool(num_threads),
+      m_strand(m_pool.get_executor()) {}
+
+TCPMessageDispatcher::~TCPMessageDispatcher() { m_pool.join(); }
+
+TCPMessageDispatcher::data_buffer TCPMessageDispatcher::acquire_buffer() {
+  std::lock_guard<std::mutex> lock(m_buffer_mutex);
+  if (m_buffers.empty()) {
+    return data_buffer(TCPMessage::header_length);
+  }
+  data_buffer buffer = std::move(m_buffers.back());
+  m_buffers.pop_back();
+  return buffer;
+}
+
+void TCPMessageDispatcher::release_buffer(data_buffer&& buffer) {
+  std::lock_guard<std::mutex> lock(m_buffer_mutex);
+  if (m_buffers.size() < max_pooled_buffers) {
+    m_buffers.emplace_back(std::move(buffer));
+  }
+}
+
+void TCPMessageDispatcher::dispatch(data_buffer&& buffer) {
+  boost::asio::post(m_strand, [this, frame = std::move(buffer)]() mutable {
+    TCPMessage message;
+    NGRAPH_CHECK(message.unpack(frame), "Error unpacking message");
+    release_buffer(std::move(frame));
+    try {
+      m_handler(message);
+    } catch (const std::exception& e) {
+      NGRAPH_ERR << "Error handling message: " << e.what();
+      throw;
+    }
+  });
+}
+
+void TCPMessageDispatcher::dispatch(TCPMessage&& message) {
+  boost::asio::post(m_strand, [this, message = std::move(message)]() {
+    try {
+      m_handler(message);
+    } catch (const std::exception& e) {
+      NGRAPH_ERR << "Error handling message: " << e.what();
+      throw;
+    }
+  });
+}
+}  // namespace ngraph::runtime::he
@@ -0,0 +1,73 @@
+//*****************************************************************************
+// Copyright 2018-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include "boost/asio.hpp"
+#include "tcp/tcp_message.hpp"
+
+namespace ngraph::runtime::he {
+/// \brief Class which handles received messages off the io thread, so the
+/// socket keeps draining while a large message is parsed and handled.
+/// Messages are handled on a worker pool, through a strand, in the order they
+/// are dispatched. Receive buffers are recycled through a pool
+class TCPMessageDispatcher {
+ public:
+  using message_handler = std::function<void(const TCPMessage&)>;
+  using data_buffer = TCPMessage::data_buffer;
+
+  /// \brief Maximum number of idle receive buffers kept for reuse
+  static constexpr size_t max_pooled_buffers = 8;
+
+  /// \brief Constructs a dispatcher
+  /// \param[in] handler Called with each dispatched message
+  /// \param[in] num_threads Number of worker threads
+  explicit TCPMessageDispatcher(message_handler handler,
+                                size_t num_threads = 1);
+
+  /// \brief Waits for dispatched messages to be handled
+  ~TCPMessageDispatcher();
+
+  /// \brief Returns a receive buffer from the pool, or a new buffer if the
+  /// pool is empty
+  data_buffer acquire_buffer();
+
+  /// \brief Unpacks a received frame without raw payloads and handles the
+  /// message on a worker. The buffer is returned to the pool afterwards
+  /// \param[in,out] buffer Buffer storing the header and protobuf message
+  void dispatch(data_buffer&& buffer);
+
+  /// \brief Handles an unpacked message on a worker
+  /// \param[in,out] message Message to handle
+  void dispatch(TCPMessage&& message);
+
+  /// \brief Returns a receive buffer to the pool
+  /// \param[in,out] buffer Buffer to return
+  void release_buffer(data_buffer&& buffer);
+
+ private:
+  message_handler m_handler;
+  boost::asio::thread_pool m_pool;
+  boost::asio::strand<boost::asio::thread_pool::executor_type> m_strand;
+
+  std::mutex m_buffer_mutex;
+  std::vector<data_buffer> m_buffers;
+};
+}  // namespace ngraph::runtime::he
@@ -16,28 +16,37 @@
 
 #include "tcp/tcp_session.hpp"
 
-#include <deque>
 #include <functional>
 #include <memory>
-#include <mutex>
 #include <utility>
 
 #include "boost/asio.hpp"
 #include "logging/ngraph_he_log.hpp"
 #include "ngraph/check.hpp"
 #include "tcp/tcp_message.hpp"
+#include "tcp/tcp_message_dispatcher.hpp"
+#include "tcp/tcp_write_queue.hpp"
 
 namespace ngraph::runtime::he {
 TCPSession::TCPSession(
-    boost::asio::ip::tcp::socket socket,
+    stream_socket socket,
     const std::function<void(const TCPMessage&)>& message_handler)
+    : TCPSession(std::move(socket),
+                 std::make_shared<TCPMessageDispatcher>(message_handler)) {}
+
+TCPSession::TCPSession(stream_socket socket,
+                       std::shared_ptr<TCPMessageDispatcher> dispatcher)
     : m_socket(std::move(socket)),
-      m_message_callback(std::bind(message_handler, std::placeholders::_1)) {}
+      m_write_queue(std::make_shared<TCPWriteQueue>(
+          m_socket,
+          [](const boost::system::error_code& ec) {
+            NGRAPH_CHECK(false, "Server error writing message: ", ec.message());
+          })),
+      m_dispatcher(std::move(dispatcher)) {}
 
 void TCPSession::do_read_header() {
-  if (m_read_buffer.size() < header_length) {
-    m_read_buffer.resize(header_length);
-  }
+  m_read_buffer = m_dispatcher->acquire_buffer();
+  m_read_buffer.resize(header_length);
   auto self(shared_from_this());
   boost::asio::async_read(
       m_socket, boost::asio::buffer(&m_read_buffer[0], header_length),
@@ -47,55 +56,55 @@ void TCPSession::do_read_header() {
             "Server error reading message header: ", ec.message());
         if (!ec) {
           size_t msg_len = TCPMessage::decode_header(m_read_buffer);
-          do_read_body(msg_len);
+          size_t payload_len = TCPMessage::decode_payload_header(m_read_buffer);
+          do_read_body(msg_len, payload_len);
         }
       });
 }
 
-void TCPSession::do_read_body(size_t body_length) {
+void TCPSession::do_read_body(size_t body_length, size_t payload_length) {
   m_read_buffer.resize(header_length + body_length);
 
   auto self(shared_from_this());
   boost::asio::async_read(
       m_socket, boost::asio::buffer(&m_read_buffer[header_length], body_length),
-      [this, self](boost::system::error_code ec, std::size_t /* length */) {
+      [this, self, payload_length](boost::system::error_code ec,
+                                   std::size_t /* length */) {
         NGRAPH_CHECK(
             !ec || ec.message() == TCPSession::s_expected_teardown_message,
             "Server error reading message body: ", ec.message());
         if (!ec) {
-          m_read_message.unpack(m_read_buffer);
-          m_message_callback(m_read_message);
-          do_read_header();
+          if (payload_length > 0) {
+            // Payloads are allocated from the protobuf metadata, so it is
+            // parsed before the payloads are read
+            m_read_message = TCPMessage();
+            m_read_message.unpack(m_read_buffer);
+            m_dispatcher->release_buffer(std::move(m_read_buffer));
+            do_read_payloads(payload_length);
+          } else {
+            m_dispatcher->dispatch(std::move(m_read_buffer));
+            do_read_header();
+          }
         }
       });
 }
 
-void TCPSession::write_message(TCPMessage&& message) {
-  bool write_in_progress = is_writing();
-  m_message_queue.emplace_back(std::move(message));
-  if (!write_in_progress) {
-    do_write();
-  }
-}
+void TCPSession::do_read_payloads(size_t payload_length) {
+  auto buffers = m_read_message.allocate_payloads(m_context);
+  NGRAPH_CHECK(boost::asio::buffer_size(buffers) == payload_length,
+               "Raw payload size ", boost::asio::buffer_size(buffers),
+               " does not match header size ", payload_length);
 
-void TCPSession::do_write() {
-  std::lock_guard<std::mutex> lock(m_write_mtx);
-  m_is_writing.notify_all();
   auto self(shared_from_this());
-  auto message = m_message_queue.front();
-  message.pack(m_write_buffer);
-  NGRAPH_HE_LOG(4) << "Server writing message size " << m_write_buffer.size()
-                   << " bytes";
-
-  boost::asio::async_write(
-      m_socket, boost::asio::buffer(m_write_buffer),
+  boost::asio::async_read(
+      m_socket, buffers,
       [this, self](boost::system::error_code ec, std::size_t /* length */) {
-        NGRAPH_CHECK(!ec, "Server error writing message: ", ec.message());
-        m_message_queue.pop_front();
-        if (!m_message_queue.empty()) {
-          do_write();
-        } else {
-          m_is_writing.notify_all();
+        NGRAPH_CHECK(
+            !ec || ec.message() == TCPSession::s_expected_teardown_message,
+            "Server error reading message payloads: ", ec.message());
+        if (!ec) {
+          m_dispatcher->dispatch(std::move(m_read_message));
+          do_read_header();
         }
       });
 }
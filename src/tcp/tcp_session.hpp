@@ -16,27 +16,40 @@
 
 #pragma once
 
-#include <deque>
 #include <functional>
 #include <memory>
-#include <mutex>
 #include <string>
+#include <utility>
 
 #include "boost/asio.hpp"
 #include "logging/ngraph_he_log.hpp"
+#include "seal/seal.h"
 #include "tcp/tcp_message.hpp"
+#include "tcp/tcp_message_dispatcher.hpp"
+#include "tcp/tcp_transport.hpp"
+#include "tcp/tcp_write_queue.hpp"
 
 namespace ngraph::runtime::he {
-/// \brief Class representing a session over TCP
+/// \brief Class representing a session over TCP, or over a Unix domain socket
+/// if the client is on the same host
 class TCPSession : public std::enable_shared_from_this<TCPSession> {
   using data_buffer = TCPMessage::data_buffer;
   size_t header_length = TCPMessage::header_length;
 
  public:
-  /// \brief Constructs a session with a given message handler
-  TCPSession(boost::asio::ip::tcp::socket socket,
+  /// \brief Constructs a session with a given message handler. Messages are
+  /// handled in order, off the io thread
+  TCPSession(stream_socket socket,
              const std::function<void(const TCPMessage&)>& message_handler);
 
+  /// \brief Constructs a session which hands its messages to a dispatcher
+  /// shared with other sessions. Used to stripe a transfer across parallel
+  /// connections, whose messages are then handled in a single order
+  /// \param[in] socket Connected socket
+  /// \param[in] dispatcher Dispatcher handling received messages
+  TCPSession(stream_socket socket,
+             std::shared_ptr<TCPMessageDispatcher> dispatcher);
+
   /// \brief Start the session
   void start() { do_read_header(); }
 
@@ -45,34 +58,52 @@ class TCPSession : public std::enable_shared_from_this<TCPSession> {
 
   /// \brief Reads message body of specified length
   /// \param[in] body_length Number of bytes to read
-  void do_read_body(size_t body_length);
+  /// \param[in] payload_length Number of raw payload bytes following the body
+  void do_read_body(size_t body_length, size_t payload_length);
+
+  /// \brief Reads raw ciphertext payloads directly into ciphertexts
+  /// \param[in] payload_length Number of bytes to read
+  void do_read_payloads(size_t payload_length);
 
-  /// \brief Adds a message to the message-writing queue
+  /// \brief Sets the SEAL context used to allocate ciphertexts read from raw
+  /// payloads
+  /// \param[in] context SEAL context
+  void set_context(std::shared_ptr<seal::SEALContext> context) {
+    m_context = std::move(context);
+  }
+
+  /// \brief Adds a message to the message-writing queue. Thread-safe
   /// \param[in,out] message Message to write
-  void write_message(TCPMessage&& message);
+  void write_message(TCPMessage&& message) {
+    m_write_queue->push(std::move(message));
+  }
 
   /// \brief Returns whether or not a message is queued to be written
-  bool is_writing() const { return !m_message_queue.empty(); }
+  bool is_writing() const { return !m_write_queue->empty(); }
 
-  /// \brief Returns a condition variable notified when the session is done
-  /// writing a message
-  std::condition_variable& is_writing_cond() { return m_is_writing; }
+  /// \brief Blocks until fewer than max_queue_size messages are queued to be
+  /// written. Used to bound the memory of messages produced faster than the
+  /// socket drains them. Must not be called from the session's io thread
+  /// \param[in] max_queue_size Number of queued messages to wait below
+  void wait_for_write_queue(size_t max_queue_size) {
+    m_write_queue->wait_for_size(max_queue_size);
+  }
 
- private:
-  void do_write();
+  /// \brief Returns the dispatcher handling the session's messages
+  const std::shared_ptr<TCPMessageDispatcher>& dispatcher() const {
+    return m_dispatcher;
+  }
 
  private:
-  std::deque<TCPMessage> m_message_queue;
   TCPMessage m_read_message;
 
   data_buffer m_read_buffer;
-  data_buffer m_write_buffer;
-  boost::asio::ip::tcp::socket m_socket;
-  std::condition_variable m_is_writing;
-  std::mutex m_write_mtx;
+  stream_socket m_socket;
+  std::shared_ptr<TCPWriteQueue> m_write_queue;
+  std::shared_ptr<seal::SEALContext> m_context;
 
   inline static std::string s_expected_teardown_message{"End of file"};
 
-  std::function<void(const TCPMessage&)> m_message_callback;
+  std::shared_ptr<TCPMessageDispatcher> m_dispatcher;
 };
 }  // namespace ngraph::runtime::he
@@ -0,0 +1,71 @@
+//*****************************************************************************
+// Copyright 2018-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "tcp/tcp_transport.hpp"
+
+#include <sys/stat.h>
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "boost/asio.hpp"
+#include "logging/ngraph_he_log.hpp"
+#include "ngraph/check.hpp"
+
+namespace ngraph::runtime::he {
+std::unique_ptr<stream_acceptor> open_acceptor(
+    boost::asio::io_context& io_context, const std::string& socket_path,
+    size_t port) {
+  if (!socket_path.empty()) {
+    NGRAPH_HE_LOG(1) << "Server listening on Unix domain socket "
+                     << socket_path;
+    // Binding fails if a previous server left its socket behind. Only remove
+    // sockets, never other files at a mistyped path
+    struct stat socket_stat {};
+    if (stat(socket_path.c_str(), &socket_stat) == 0) {
+      NGRAPH_CHECK(S_ISSOCK(socket_stat.st_mode), "Socket path ", socket_path,
+                   " exists and is not a socket");
+      std::remove(socket_path.c_str());
+    }
+    return std::make_unique<stream_acceptor>(
+        io_context,
+        stream_endpoint(
+            boost::asio::local::stream_protocol::endpoint(socket_path)));
+  }
+  NGRAPH_HE_LOG(1) << "Server listening on port " << port;
+  return std::make_unique<stream_acceptor>(
+      io_context, stream_endpoint(boost::asio::ip::tcp::endpoint(
+                      boost::asio::ip::tcp::v4(), port)));
+}
+
+std::vector<stream_endpoint> resolve_endpoints(
+    boost::asio::io_context& io_context, const std::string& hostname,
+    size_t port) {
+  if (hostname.compare(0, unix_socket_prefix.size(), unix_socket_prefix) ==
+      0) {
+    return {boost::asio::local::stream_protocol::endpoint(
+        hostname.substr(unix_socket_prefix.size()))};
+  }
+  boost::asio::ip::tcp::resolver resolver(io_context);
+  std::vector<stream_endpoint> endpoints;
+  for (const auto& entry : resolver.resolve(hostname, std::to_string(port))) {
+    endpoints.emplace_back(entry.endpoint());
+  }
+  return endpoints;
+}
+}  // namespace ngraph::runtime::he
@@ -0,0 +1,59 @@
+//*****************************************************************************
+// Copyright 2018-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "boost/asio.hpp"
+
+namespace ngraph::runtime::he {
+/// \brief Socket over which sessions and clients exchange messages. A generic
+/// stream socket holds either a TCP socket, or a Unix domain socket for a
+/// client on the same host as the server
+using stream_socket = boost::asio::generic::stream_protocol::socket;
+
+/// \brief Endpoint of a stream_socket
+using stream_endpoint = boost::asio::generic::stream_protocol::endpoint;
+
+/// \brief Acceptor of stream_socket connections
+using stream_acceptor =
+    boost::asio::basic_socket_acceptor<boost::asio::generic::stream_protocol>;
+
+/// \brief Hostname prefix naming a Unix domain socket, e.g.
+/// "unix:/tmp/he_server.sock"
+inline const std::string unix_socket_prefix{"unix:"};
+
+/// \brief Opens an acceptor listening for client connections
+/// \param[in] io_context Boost context for I/O functionality
+/// \param[in] socket_path If non-empty, path of a Unix domain socket to listen
+/// on. A stale socket at the path is removed
+/// \param[in] port TCP port to listen on if socket_path is empty
+std::unique_ptr<stream_acceptor> open_acceptor(
+    boost::asio::io_context& io_context, const std::string& socket_path,
+    size_t port);
+
+/// \brief Resolves the endpoints a client connects to
+/// \param[in] io_context Boost context for I/O functionality
+/// \param[in] hostname Hostname of the server, or unix_socket_prefix followed
+/// by the path of the server's Unix domain socket
+/// \param[in] port TCP port of the server. Unused for Unix domain sockets
+std::vector<stream_endpoint> resolve_endpoints(
+    boost::asio::io_context& io_context, const std::string& hostname,
+    size_t port);
+}  // namespace ngraph::runtime::he
@@ -0,0 +1,110 @@
+//*****************************************************************************
+// Copyright 2018-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "tcp/tcp_write_queue.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include "logging/ngraph_he_log.hpp"
+
+namespace ngraph::runtime::he {
+TCPWriteQueue::TCPWriteQueue(socket_type& socket, error_handler on_error)
+    : m_socket(socket),
+      m_strand(socket.get_executor()),
+      m_on_error(std::move(on_error)) {}
+
+void TCPWriteQueue::push(TCPMessage&& message) {
+  bool start_write;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_queue.emplace_back(std::move(message));
+    start_write = !m_writing;
+    m_writing = true;
+  }
+  if (start_write) {
+    auto self(shared_from_this());
+    boost::asio::post(m_strand, [this, self]() { do_write(); });
+  }
+}
+
+size_t TCPWriteQueue::size() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_queue.size() + m_in_flight_count;
+}
+
+void TCPWriteQueue::wait_for_size(size_t max_size) {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_cond.wait(lock, [this, max_size] {
+    return m_queue.size() + m_in_flight_count < max_size;
+  });
+}
+
+void TCPWriteQueue::do_write() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    size_t batch_size = std::min(m_queue.size(), max_batch_message_count);
+    for (size_t msg_idx = 0; msg_idx < batch_size; ++msg_idx) {
+      m_in_flight.emplace_back(std::move(m_queue.front()));
+      m_queue.pop_front();
+    }
+    m_in_flight_count = batch_size;
+  }
+  if (m_write_buffers.size() < m_in_flight.size()) {
+    m_write_buffers.resize(m_in_flight.size());
+  }
+  std::vector<boost::asio::const_buffer> buffers;
+  for (size_t msg_idx = 0; msg_idx < m_in_flight.size(); ++msg_idx) {
+    auto& write_buffer = m_write_buffers[msg_idx];
+    m_in_flight[msg_idx].pack(write_buffer);
+    auto msg_buffers = m_in_flight[msg_idx].write_buffers(write_buffer);
+    buffers.insert(buffers.end(), msg_buffers.begin(), msg_buffers.end());
+  }
+  NGRAPH_HE_LOG(4) << "Writing " << m_in_flight.size() << " messages size "
+                   << boost::asio::buffer_size(buffers) << " bytes";
+
+  auto self(shared_from_this());
+  boost::asio::async_write(
+      m_socket, buffers,
+      boost::asio::bind_executor(
+          m_strand, [this, self](boost::system::error_code ec,
+                                 std::size_t /* length */) {
+            m_in_flight.clear();
+            if (ec) {
+              {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_queue.clear();
+                m_in_flight_count = 0;
+                m_writing = false;
+              }
+              m_cond.notify_all();
+              m_on_error(ec);
+              return;
+            }
+            bool write_more;
+            {
+              std::lock_guard<std::mutex> lock(m_mutex);
+              write_more = !m_queue.empty();
+              m_in_flight_count = 0;
+              m_writing = write_more;
+            }
+            m_cond.notify_all();
+            if (write_more) {
+              do_write();
+            }
+          }));
+}
+}  // namespace ngraph::runtime::he
@@ -0,0 +1,83 @@
+//*****************************************************************************
+// Copyright 2018-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "boost/asio.hpp"
+#include "tcp/tcp_message.hpp"
+#include "tcp/tcp_transport.hpp"
+
+namespace ngraph::runtime::he {
+/// \brief Class representing a thread-safe queue of messages written to a
+/// socket. Messages may be pushed from any thread. Writes run on a strand of
+/// the socket's executor, and all messages queued while a write is in flight
+/// are coalesced into the next gather write
+class TCPWriteQueue : public std::enable_shared_from_this<TCPWriteQueue> {
+ public:
+  using socket_type = stream_socket;
+  using error_handler = std::function<void(const boost::system::error_code&)>;
+
+  /// \brief Maximum number of messages coalesced into a single write
+  static constexpr size_t max_batch_message_count = 32;
+
+  /// \brief Constructs a write queue for the given socket
+  /// \param[in] socket Socket to write to. Must outlive pending writes
+  /// \param[in] on_error Called on the strand if a write fails. Queued
+  /// messages are not written after an error
+  TCPWriteQueue(socket_type& socket, error_handler on_error);
+
+  /// \brief Adds a message to the queue, starting a write if none is in
+  /// flight
+  /// \param[in,out] message Message to write
+  void push(TCPMessage&& message);
+
+  /// \brief Returns the number of messages queued or being written
+  size_t size() const;
+
+  /// \brief Returns whether or not no messages are queued or being written
+  bool empty() const { return size() == 0; }
+
+  /// \brief Blocks until fewer than max_size messages are queued or being
+  /// written. Must not be called from the thread running the socket's
+  /// executor
+  /// \param[in] max_size Number of messages to wait below
+  void wait_for_size(size_t max_size);
+
+ private:
+  void do_write();
+
+  socket_type& m_socket;
+  boost::asio::strand<socket_type::executor_type> m_strand;
+  error_handler m_on_error;
+
+  mutable std::mutex m_mutex;
+  std::condition_variable m_cond;
+  std::deque<TCPMessage> m_queue;
+  size_t m_in_flight_count{0};
+  bool m_writing{false};
+
+  // Accessed only on the strand
+  std::vector<TCPMessage> m_in_flight;
+  std::vector<TCPMessage::data_buffer> m_write_buffers;
+};
+}  // namespace ngraph::runtime::he
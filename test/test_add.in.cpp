@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include "he_op_annotations.hpp"
+#include "he_tensor.hpp"
 #include "ngraph/ngraph.hpp"
 #include "seal/he_seal_backend.hpp"
 #include "seal/kernel/add_seal.hpp"
@@ -243,4 +244,35 @@ NGRAPH_TEST(${BACKEND_NAME}, add_wrong_output_type) {
   }
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, add_rejects_non_batch_axis_packing) {
+  auto backend = runtime::Backend::create("${BACKEND_NAME}");
+  auto he_backend = static_cast<HESealBackend*>(backend.get());
+
+  Shape shape{2, 3};
+  auto a = std::make_shared<op::Parameter>(element::f32, shape);
+  auto b = std::make_shared<op::Parameter>(element::f32, shape);
+  auto t = std::make_shared<op::Add>(a, b);
+  auto f = std::make_shared<Function>(t, ParameterVector{a, b});
+
+  std::string error_str;
+  he_backend->set_config(
+      {{a->get_name(), test::config_from_flags(false, true, true)},
+       {b->get_name(), test::config_from_flags(false, true, true)}},
+      error_str);
+
+  // Intermediate tensors are packed along axis 0, so packing the inputs
+  // along axis 1 would transpose the result
+  auto t_a = std::make_shared<HETensor>(element::f32, shape, AxisSet{1},
+                                        false, true, *he_backend);
+  auto t_b = std::make_shared<HETensor>(element::f32, shape, AxisSet{1},
+                                        false, true, *he_backend);
+  auto t_result = test::tensor_from_flags(*he_backend, shape, true, true);
+
+  copy_data(t_a, std::vector<float>{1, 2, 3, 4, 5, 6});
+  copy_data(t_b, std::vector<float>{7, 8, 9, 10, 11, 12});
+
+  auto handle = backend->compile(f);
+  EXPECT_ANY_THROW(handle->call({t_result}, {t_a, t_b}));
+}
+
 }  // namespace ngraph::runtime::he
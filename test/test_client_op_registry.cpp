@@ -0,0 +1,107 @@
+//*****************************************************************************
+// Copyright 2018-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "seal/client_op_registry.hpp"
+#include "test_util.hpp"
+
+namespace ngraph::runtime::he {
+
+auto as_vector = [](const HEPlaintext& plain) {
+  return std::vector<double>(plain.begin(), plain.end());
+};
+
+TEST(client_op_registry, builtin_ops) {
+  const auto& registry = ClientOpRegistry::instance();
+  for (const auto& name :
+       {"Divide", "Exp", "Max", "Minimum", "Sigmoid", "Softmax"}) {
+    EXPECT_TRUE(registry.is_registered(name));
+  }
+  EXPECT_FALSE(registry.is_registered("Relu"));
+  EXPECT_ANY_THROW(registry.kernel("Relu"));
+}
+
+TEST(client_op_registry, sigmoid) {
+  std::vector<std::vector<HEPlaintext>> args{
+      {HEPlaintext{0, 1}, HEPlaintext{-2, 3}}};
+  std::vector<HEPlaintext> out(2);
+
+  ClientOpRegistry::instance().kernel("Sigmoid")(
+      args, {Shape{2}}, out, Shape{2}, nlohmann::json::object());
+
+  auto sigmoid = [](double x) { return 1. / (1. + std::exp(-x)); };
+  for (size_t i = 0; i < out.size(); ++i) {
+    std::vector<double> expected{sigmoid(args[0][i][0]),
+                                 sigmoid(args[0][i][1])};
+    EXPECT_TRUE(test::all_close(as_vector(out[i]), expected));
+  }
+}
+
+TEST(client_op_registry, divide) {
+  std::vector<std::vector<HEPlaintext>> args{{HEPlaintext{1, 4}},
+                                             {HEPlaintext{2, 2}}};
+  std::vector<HEPlaintext> out(1);
+
+  ClientOpRegistry::instance().kernel("Divide")(args, {Shape{1}, Shape{1}},
+                                                out, Shape{1},
+                                                nlohmann::json::object());
+  EXPECT_TRUE(
+      test::all_close(as_vector(out[0]), std::vector<double>{0.5, 2}));
+}
+
+TEST(client_op_registry, max) {
+  auto a = std::make_shared<op::Parameter>(element::f32, Shape{2, 2});
+  auto max = std::make_shared<op::Max>(a, AxisSet{0});
+
+  const auto& registry = ClientOpRegistry::instance();
+  std::vector<std::vector<HEPlaintext>> args{
+      {HEPlaintext{1, 0}, HEPlaintext{2, 0}, HEPlaintext{3, 0},
+       HEPlaintext{1, 5}}};
+  std::vector<HEPlaintext> out(2);
+
+  registry.kernel("Max")(args, {Shape{2, 2}}, out, Shape{2},
+                         registry.attributes(*max));
+  EXPECT_TRUE(test::all_close(as_vector(out[0]), std::vector<double>{3, 0}));
+  EXPECT_TRUE(test::all_close(as_vector(out[1]), std::vector<double>{2, 5}));
+}
+
+TEST(client_op_registry, softmax) {
+  auto a = std::make_shared<op::Parameter>(element::f32, Shape{2, 2});
+  auto softmax = std::make_shared<op::Softmax>(a, AxisSet{1});
+
+  const auto& registry = ClientOpRegistry::instance();
+  std::vector<std::vector<HEPlaintext>> args{{HEPlaintext{1}, HEPlaintext{2},
+                                              HEPlaintext{3}, HEPlaintext{3}}};
+  std::vector<HEPlaintext> out(4);
+
+  registry.kernel("Softmax")(args, {Shape{2, 2}}, out, Shape{2, 2},
+                             registry.attributes(*softmax));
+
+  double e = std::exp(1.);
+  EXPECT_TRUE(
+      test::all_close(as_vector(out[0]), std::vector<double>{1 / (1 + e)}));
+  EXPECT_TRUE(
+      test::all_close(as_vector(out[1]), std::vector<double>{e / (1 + e)}));
+  EXPECT_TRUE(test::all_close(as_vector(out[2]), std::vector<double>{0.5}));
+  EXPECT_TRUE(test::all_close(as_vector(out[3]), std::vector<double>{0.5}));
+}
+
+}  // namespace ngraph::runtime::he
@@ -0,0 +1,221 @@
+//*****************************************************************************
+// Copyright 2018-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "he_op_annotations.hpp"
+#include "ngraph/ngraph.hpp"
+#include "pass/defer_relinearization.hpp"
+#include "pass/propagate_he_annotations.hpp"
+#include "seal/he_seal_backend.hpp"
+#include "seal/kernel/add_seal.hpp"
+#include "seal/kernel/convolution_seal.hpp"
+#include "seal/kernel/dot_seal.hpp"
+#include "seal/kernel/mod_reduce_seal.hpp"
+#include "seal/kernel/relinearize_seal.hpp"
+#include "seal/seal_util.hpp"
+#include "test_util.hpp"
+#include "util/test_tools.hpp"
+
+namespace ngraph::runtime::he {
+
+auto defer_relinearization_test = [](bool arg1_enc, bool arg2_enc) {
+  Shape shape{2, 2};
+
+  auto a = std::make_shared<op::Parameter>(element::f32, shape);
+  auto b = std::make_shared<op::Parameter>(element::f32, shape);
+  auto t = std::make_shared<op::Dot>(a, b);
+  auto f = std::make_shared<Function>(t, ParameterVector{a, b});
+
+  a->set_op_annotations(test::annotation_from_flags(false, arg1_enc, false));
+  b->set_op_annotations(test::annotation_from_flags(false, arg2_enc, false));
+
+  pass::PropagateHEAnnotations().run_on_function(f);
+  pass::DeferRelinearization().run_on_function(f);
+
+  EXPECT_FALSE(HEOpAnnotations::defer_relinearization(*a));
+  EXPECT_FALSE(HEOpAnnotations::defer_relinearization(*b));
+  EXPECT_EQ(HEOpAnnotations::defer_relinearization(*t), arg1_enc && arg2_enc);
+};
+
+TEST(defer_relinearization, plain_plain) {
+  defer_relinearization_test(false, false);
+}
+
+TEST(defer_relinearization, plain_cipher) {
+  defer_relinearization_test(false, true);
+}
+
+TEST(defer_relinearization, cipher_plain) {
+  defer_relinearization_test(true, false);
+}
+
+TEST(defer_relinearization, cipher_cipher) {
+  defer_relinearization_test(true, true);
+}
+
+TEST(defer_relinearization, elementwise_multiply) {
+  Shape shape{2, 2};
+
+  auto a = std::make_shared<op::Parameter>(element::f32, shape);
+  auto b = std::make_shared<op::Parameter>(element::f32, shape);
+  auto t = std::make_shared<op::Multiply>(a, b);
+  auto f = std::make_shared<Function>(t, ParameterVector{a, b});
+
+  a->set_op_annotations(test::annotation_from_flags(false, true, false));
+  b->set_op_annotations(test::annotation_from_flags(false, true, false));
+
+  pass::PropagateHEAnnotations().run_on_function(f);
+  pass::DeferRelinearization().run_on_function(f);
+
+  EXPECT_FALSE(HEOpAnnotations::defer_relinearization(*t));
+}
+
+auto encrypt_values = [](const std::vector<double>& values,
+                         HESealBackend& he_backend) {
+  std::vector<HEType> out;
+  for (const double value : values) {
+    auto cipher = HESealBackend::create_empty_ciphertext();
+    encrypt(cipher, HEPlaintext{value},
+            he_backend.get_context()->first_parms_id(), element::f32,
+            he_backend.get_scale(), *he_backend.get_ckks_encoder(),
+            *he_backend.get_encryptor(), false);
+    out.emplace_back(cipher, false, 1);
+  }
+  return out;
+};
+
+auto decrypt_values = [](const std::vector<HEType>& values,
+                         HESealBackend& he_backend) {
+  std::vector<double> out;
+  for (const auto& value : values) {
+    HEPlaintext plain;
+    decrypt(plain, *value.get_ciphertext(), false,
+            *he_backend.get_decryptor(), *he_backend.get_ckks_encoder(),
+            he_backend.get_context(), 1);
+    out.emplace_back(plain[0]);
+  }
+  return out;
+};
+
+TEST(defer_relinearization, dot_kernel) {
+  auto backend = runtime::Backend::create("HE_SEAL");
+  auto he_backend = static_cast<HESealBackend*>(backend.get());
+
+  Shape shape_a{2, 3};
+  Shape shape_b{3, 2};
+  Shape shape_r{2, 2};
+  auto a = encrypt_values({1, 2, 3, 4, 5, 6}, *he_backend);
+  auto b = encrypt_values({1, 2, 3, 4, 5, 6}, *he_backend);
+
+  std::vector<HEType> relinearized(shape_size(shape_r),
+                                   HEType(HEPlaintext(), false));
+  std::vector<HEType> deferred(shape_size(shape_r),
+                               HEType(HEPlaintext(), false));
+  dot_seal(a, b, relinearized, shape_a, shape_b, shape_r, 1, element::f32, 1,
+           *he_backend, true);
+  dot_seal(a, b, deferred, shape_a, shape_b, shape_r, 1, element::f32, 1,
+           *he_backend, false);
+
+  for (const auto& value : deferred) {
+    EXPECT_EQ(value.get_ciphertext()->ciphertext().size(), 3);
+  }
+  relinearize_seal(deferred, *he_backend);
+  for (const auto& value : deferred) {
+    EXPECT_EQ(value.get_ciphertext()->ciphertext().size(), 2);
+  }
+
+  std::vector<double> expected{22, 28, 49, 64};
+  EXPECT_TRUE(test::all_close(decrypt_values(relinearized, *he_backend),
+                              expected, 1e-2));
+  EXPECT_TRUE(test::all_close(decrypt_values(deferred, *he_backend),
+                              expected, 1e-2));
+}
+
+TEST(defer_relinearization, convolution_kernel) {
+  auto backend = runtime::Backend::create("HE_SEAL");
+  auto he_backend = static_cast<HESealBackend*>(backend.get());
+
+  Shape shape_a{1, 1, 3, 3};
+  Shape shape_b{1, 1, 2, 2};
+  Shape shape_r{1, 1, 2, 2};
+  auto a = encrypt_values({1, 2, 3, 4, 5, 6, 7, 8, 9}, *he_backend);
+  auto b = encrypt_values({1, 2, 3, 4}, *he_backend);
+
+  auto convolution = [&](std::vector<HEType>& out, bool relinearize) {
+    convolution_seal(a, b, out, shape_a, shape_b, shape_r, Strides{1, 1},
+                     Strides{1, 1}, CoordinateDiff{0, 0}, CoordinateDiff{0, 0},
+                     Strides{1, 1}, 0, 1, 1, 0, 0, 1, element::f32, 1,
+                     *he_backend, false, relinearize);
+  };
+
+  std::vector<HEType> relinearized(shape_size(shape_r),
+                                   HEType(HEPlaintext(), false));
+  std::vector<HEType> deferred(shape_size(shape_r),
+                               HEType(HEPlaintext(), false));
+  convolution(relinearized, true);
+  convolution(deferred, false);
+
+  for (const auto& value : deferred) {
+    EXPECT_EQ(value.get_ciphertext()->ciphertext().size(), 3);
+  }
+  relinearize_seal(deferred, *he_backend);
+
+  std::vector<double> expected{37, 47, 67, 77};
+  EXPECT_TRUE(test::all_close(decrypt_values(relinearized, *he_backend),
+                              expected, 1e-2));
+  EXPECT_TRUE(test::all_close(decrypt_values(deferred, *he_backend),
+                              expected, 1e-2));
+}
+
+TEST(defer_relinearization, lazy_add_unrelinearized) {
+  auto backend = runtime::Backend::create("HE_SEAL");
+  auto he_backend = static_cast<HESealBackend*>(backend.get());
+  auto evaluator = he_backend->get_evaluator();
+
+  auto x = encrypt_values({2, 3}, *he_backend);
+  auto y = encrypt_values({4, 5}, *he_backend);
+
+  // Relinearized product 2 * 3 accumulates the unrelinearized product 4 * 5
+  auto sum = HESealBackend::create_empty_ciphertext();
+  evaluator->multiply(x[0].get_ciphertext()->ciphertext(),
+                      x[1].get_ciphertext()->ciphertext(), sum->ciphertext());
+  evaluator->relinearize_inplace(sum->ciphertext(),
+                                 *he_backend->get_relin_keys());
+  auto product = HESealBackend::create_empty_ciphertext();
+  evaluator->multiply(y[0].get_ciphertext()->ciphertext(),
+                      y[1].get_ciphertext()->ciphertext(),
+                      product->ciphertext());
+  EXPECT_EQ(sum->ciphertext().size(), 2);
+  EXPECT_EQ(product->ciphertext().size(), 3);
+
+  he_backend->lazy_mod() = true;
+  scalar_add_seal(*product, *sum, sum, *he_backend);
+  he_backend->lazy_mod() = false;
+  EXPECT_EQ(sum->ciphertext().size(), 3);
+
+  std::vector<HEType> out{HEType(sum, false, 1)};
+  mod_reduce_seal(out, *he_backend);
+  relinearize_seal(out, *he_backend);
+  EXPECT_EQ(out[0].get_ciphertext()->ciphertext().size(), 2);
+
+  EXPECT_TRUE(test::all_close(decrypt_values(out, *he_backend),
+                              std::vector<double>{26}, 1e-2));
+}
+
+}  // namespace ngraph::runtime::he
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include "he_op_annotations.hpp"
+#include "he_tensor.hpp"
 #include "ngraph/ngraph.hpp"
 #include "seal/he_seal_backend.hpp"
 #include "test_util.hpp"
@@ -307,4 +308,33 @@ NGRAPH_TEST(${BACKEND_NAME},
            true, false, false);
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, dot_rejects_non_batch_axis_packing) {
+  auto backend = runtime::Backend::create("${BACKEND_NAME}");
+  auto he_backend = static_cast<HESealBackend*>(backend.get());
+
+  Shape shape{2, 2};
+  auto a = std::make_shared<op::Parameter>(element::f32, shape);
+  auto b = std::make_shared<op::Parameter>(element::f32, shape);
+  auto t = std::make_shared<op::Dot>(a, b);
+  auto f = std::make_shared<Function>(t, ParameterVector{a, b});
+
+  std::string error_str;
+  he_backend->set_config(
+      {{a->get_name(), test::config_from_flags(false, false, true)},
+       {b->get_name(), test::config_from_flags(false, false, false)}},
+      error_str);
+
+  // Only packing along the batch axis is supported
+  auto t_a = std::make_shared<HETensor>(element::f32, shape, AxisSet{1},
+                                        false, false, *he_backend);
+  auto t_b = test::tensor_from_flags(*he_backend, shape, false, false);
+  auto t_result = test::tensor_from_flags(*he_backend, shape, false, true);
+
+  copy_data(t_a, std::vector<float>{1, 2, 3, 4});
+  copy_data(t_b, std::vector<float>{5, 6, 7, 8});
+
+  auto handle = backend->compile(f);
+  EXPECT_ANY_THROW(handle->call({t_result}, {t_a, t_b}));
+}
+
 }  // namespace ngraph::runtime::he
@@ -190,4 +190,42 @@ TEST(encryption_parameters, choose_scale) {
   test_choose_scale(std::vector<int>{54, 54, 54});
 }
 
+TEST(encryption_parameters, choose_parameters) {
+  auto coeff_modulus_bits = [](const HESealEncryptionParameters& parms) {
+    std::vector<int> bits;
+    for (const auto& modulus :
+         parms.seal_encryption_parameters().coeff_modulus()) {
+      bits.push_back(modulus.bit_count());
+    }
+    return bits;
+  };
+
+  auto parms = HESealEncryptionParameters::choose_parameters(5, 24, 6, 128,
+                                                             false);
+  EXPECT_EQ(parms.poly_modulus_degree(), 8192);
+  EXPECT_EQ(coeff_modulus_bits(parms),
+            (std::vector<int>{30, 24, 24, 24, 24, 24, 30}));
+  EXPECT_EQ(parms.scale(), 1 << 24);
+  EXPECT_EQ(parms.security_level(), 128);
+  EXPECT_FALSE(parms.complex_packing());
+
+  parms = HESealEncryptionParameters::choose_parameters(0, 24, 6, 128, true);
+  EXPECT_EQ(parms.poly_modulus_degree(), 2048);
+  EXPECT_EQ(coeff_modulus_bits(parms), (std::vector<int>{30}));
+  EXPECT_TRUE(parms.complex_packing());
+
+  // Precision too large for a single modulus
+  EXPECT_ANY_THROW(
+      HESealEncryptionParameters::choose_parameters(1, 58, 6, 128, false));
+}
+
+TEST(encryption_parameters, to_json_string) {
+  auto parms = HESealEncryptionParameters::choose_parameters(3, 24, 6, 128,
+                                                             false);
+  auto json_str = parms.to_json_string();
+  auto loaded_parms =
+      HESealEncryptionParameters::parse_config_or_use_default(json_str.c_str());
+  EXPECT_EQ(parms, loaded_parms);
+}
+
 }  // namespace ngraph::runtime::he
@@ -0,0 +1,104 @@
+//*****************************************************************************
+// Copyright 2018-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+
+#include "gtest/gtest.h"
+#include "he_op_annotations.hpp"
+#include "ngraph/ngraph.hpp"
+#include "op/bounded_relu.hpp"
+#include "pass/fuse_client_ops.hpp"
+#include "pass/propagate_he_annotations.hpp"
+#include "test_util.hpp"
+#include "util/test_tools.hpp"
+
+namespace ngraph::runtime::he {
+
+auto fuse_client_ops_test = [](bool arg_enc) {
+  Shape shape{1, 1, 4, 4};
+
+  auto a = std::make_shared<op::Parameter>(element::f32, shape);
+  auto relu = std::make_shared<op::Relu>(a);
+  auto max_pool = std::make_shared<op::MaxPool>(relu, Shape{2, 2});
+  auto f = std::make_shared<Function>(max_pool, ParameterVector{a});
+
+  a->set_op_annotations(test::annotation_from_flags(false, arg_enc, false));
+
+  pass::PropagateHEAnnotations().run_on_function(f);
+  pass::FuseClientOps().run_on_function(f);
+
+  EXPECT_FALSE(HEOpAnnotations::client_fused(*a));
+  EXPECT_EQ(HEOpAnnotations::client_fused(*relu), arg_enc);
+  EXPECT_FALSE(HEOpAnnotations::client_fused(*max_pool));
+};
+
+TEST(fuse_client_ops, relu_max_pool_plain) { fuse_client_ops_test(false); }
+
+TEST(fuse_client_ops, relu_max_pool_cipher) { fuse_client_ops_test(true); }
+
+TEST(fuse_client_ops, bounded_relu_max_pool) {
+  Shape shape{1, 1, 4, 4};
+
+  auto a = std::make_shared<op::Parameter>(element::f32, shape);
+  auto relu = std::make_shared<op::BoundedRelu>(a, 6.0f);
+  auto max_pool = std::make_shared<op::MaxPool>(relu, Shape{2, 2});
+  auto f = std::make_shared<Function>(max_pool, ParameterVector{a});
+
+  a->set_op_annotations(test::annotation_from_flags(false, true, false));
+
+  pass::PropagateHEAnnotations().run_on_function(f);
+  pass::FuseClientOps().run_on_function(f);
+
+  EXPECT_TRUE(HEOpAnnotations::client_fused(*relu));
+}
+
+TEST(fuse_client_ops, multiple_consumers) {
+  Shape shape{1, 1, 4, 4};
+
+  auto a = std::make_shared<op::Parameter>(element::f32, shape);
+  auto relu = std::make_shared<op::Relu>(a);
+  auto max_pool = std::make_shared<op::MaxPool>(relu, Shape{2, 2});
+  auto negate = std::make_shared<op::Negative>(relu);
+  auto f = std::make_shared<Function>(NodeVector{max_pool, negate},
+                                      ParameterVector{a});
+
+  a->set_op_annotations(test::annotation_from_flags(false, true, false));
+
+  pass::PropagateHEAnnotations().run_on_function(f);
+  pass::FuseClientOps().run_on_function(f);
+
+  // The relu output is needed by the Negative op
+  EXPECT_FALSE(HEOpAnnotations::client_fused(*relu));
+}
+
+TEST(fuse_client_ops, garbled_circuits) {
+  Shape shape{1, 1, 4, 4};
+
+  auto a = std::make_shared<op::Parameter>(element::f32, shape);
+  auto relu = std::make_shared<op::Relu>(a);
+  auto max_pool = std::make_shared<op::MaxPool>(relu, Shape{2, 2});
+  auto f = std::make_shared<Function>(max_pool, ParameterVector{a});
+
+  a->set_op_annotations(test::annotation_from_flags(false, true, false));
+
+  pass::PropagateHEAnnotations().run_on_function(f);
+  pass::FuseClientOps(true).run_on_function(f);
+
+  // Fusing would reveal the pre-activation values to the client
+  EXPECT_FALSE(HEOpAnnotations::client_fused(*relu));
+}
+
+}  // namespace ngraph::runtime::he
@@ -43,6 +43,25 @@ TEST(he_op_annotations, set_get) {
 
   ann.set_packed(false);
   EXPECT_FALSE(ann.packed());
+
+  EXPECT_FALSE(ann.defer_relinearization());
+  ann.set_defer_relinearization(true);
+  EXPECT_TRUE(ann.defer_relinearization());
+
+  ann.set_defer_relinearization(false);
+  EXPECT_FALSE(ann.defer_relinearization());
+
+  EXPECT_FALSE(ann.rescale());
+  ann.set_rescale(true);
+  EXPECT_TRUE(ann.rescale());
+
+  EXPECT_EQ(ann.level(), 0U);
+  ann.set_level(3);
+  EXPECT_EQ(ann.level(), 3U);
+
+  EXPECT_FALSE(ann.refresh());
+  ann.set_refresh(true);
+  EXPECT_TRUE(ann.refresh());
 }
 
 TEST(he_op_annotations, initialize) {
@@ -57,6 +76,9 @@ TEST(he_op_annotations, defaults) {
 
   EXPECT_FALSE(HEOpAnnotations::from_client(*param));
   EXPECT_FALSE(HEOpAnnotations::plaintext_packed(*param));
+  EXPECT_FALSE(HEOpAnnotations::defer_relinearization(*param));
+  EXPECT_FALSE(HEOpAnnotations::rescale(*param));
+  EXPECT_FALSE(HEOpAnnotations::refresh(*param));
 }
 
 }  // namespace ngraph::runtime::he
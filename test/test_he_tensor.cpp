@@ -14,7 +14,9 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstring>
 #include <memory>
+#include <numeric>
 
 #include "gtest/gtest.h"
 #include "he_tensor.hpp"
@@ -55,8 +57,103 @@ TEST(he_tensor, empty_cipher_tensor) {
 }
 
 TEST(he_tensor, pack_non_zero_axis) {
-  EXPECT_ANY_THROW(HETensor::pack_shape(Shape{2, 1}, 1));
-  EXPECT_ANY_THROW(HETensor::unpack_shape(Shape{1, 1}, 2, 1));
+  EXPECT_EQ(HETensor::pack_shape(Shape{2, 3}, 1), (Shape{2, 1}));
+  EXPECT_EQ(HETensor::unpack_shape(Shape{2, 1}, 3, 1), (Shape{2, 3}));
+  EXPECT_EQ(HETensor::pack_shape(Shape{2, 3, 4}, AxisSet{0, 2}),
+            (Shape{1, 3, 1}));
+  EXPECT_EQ(HETensor::batch_size(Shape{2, 3, 4}, AxisSet{0, 2}), 8U);
+
+  // Axis out of range
+  EXPECT_ANY_THROW(HETensor::pack_shape(Shape{2, 1}, 2));
+  EXPECT_ANY_THROW(HETensor::unpack_shape(Shape{1, 1}, 2, 2));
+}
+
+TEST(he_tensor, pack_multiple_axes) {
+  auto backend = runtime::Backend::create("HE_SEAL");
+  auto he_backend = static_cast<HESealBackend*>(backend.get());
+
+  Shape shape{2, 3, 2};
+  HETensor plain(element::f32, shape, false, false, false, *he_backend);
+  std::vector<float> values(shape_size(shape));
+  std::iota(values.begin(), values.end(), 0);
+  plain.write(values.data(), values.size() * sizeof(float));
+
+  plain.pack(AxisSet{0, 2});
+  EXPECT_TRUE(plain.is_packed());
+  EXPECT_EQ(plain.get_pack_axes(), (AxisSet{0, 2}));
+  EXPECT_EQ(plain.get_packed_shape(), (Shape{1, 3, 1}));
+  EXPECT_EQ(plain.get_batch_size(), 4);
+  ASSERT_EQ(plain.data().size(), 3);
+
+  // Element i holds values at (b, i, c), ordered row-major over (b, c)
+  for (size_t i = 0; i < 3; ++i) {
+    const auto& packed = plain.data(i).get_plaintext();
+    ASSERT_EQ(packed.size(), 4);
+    EXPECT_EQ(packed[0], 2 * i);
+    EXPECT_EQ(packed[1], 2 * i + 1);
+    EXPECT_EQ(packed[2], 6 + 2 * i);
+    EXPECT_EQ(packed[3], 6 + 2 * i + 1);
+  }
+
+  std::vector<float> read_values(values.size());
+  plain.read(read_values.data(), read_values.size() * sizeof(float));
+  EXPECT_EQ(read_values, values);
+
+  plain.unpack();
+  EXPECT_FALSE(plain.is_packed());
+  EXPECT_EQ(plain.data().size(), shape_size(shape));
+  for (size_t i = 0; i < values.size(); ++i) {
+    EXPECT_EQ(plain.data(i).get_plaintext()[0], values[i]);
+  }
+}
+
+TEST(he_tensor, read_range) {
+  auto backend = runtime::Backend::create("HE_SEAL");
+  auto he_backend = static_cast<HESealBackend*>(backend.get());
+
+  Shape shape{2, 3, 2};
+  HETensor tensor(element::f32, shape, AxisSet{0, 2}, false, true,
+                  *he_backend);
+  std::vector<float> values(shape_size(shape));
+  std::iota(values.begin(), values.end(), 0);
+  tensor.write(values.data(), values.size() * sizeof(float));
+  ASSERT_EQ(tensor.data().size(), 3);
+
+  // Reading each range in any order fills in the whole tensor
+  std::vector<float> read_values(values.size());
+  tensor.read_range(read_values.data(), 1, 2);
+  tensor.read_range(read_values.data(), 0, 1);
+  EXPECT_TRUE(test::all_close(read_values, values, 1e-3f));
+
+  EXPECT_ANY_THROW(tensor.read_range(read_values.data(), 2, 2));
+}
+
+TEST(he_tensor, cipher_pack_axis) {
+  auto backend = runtime::Backend::create("HE_SEAL");
+  auto he_backend = static_cast<HESealBackend*>(backend.get());
+
+  Shape shape{2, 3};
+  auto tensor = std::make_shared<HETensor>(element::f32, shape, AxisSet{1},
+                                           false, true, *he_backend);
+  EXPECT_EQ(tensor->data().size(), 2);
+  EXPECT_EQ(tensor->get_batch_size(), 3);
+
+  std::vector<float> values{1, 2, 3, 4, 5, 6};
+  copy_data(tensor, values);
+  EXPECT_TRUE(test::all_close(read_vector<float>(tensor), values, 1e-3f));
+
+  auto pb_tensors = tensor->write_to_pb_tensors();
+  ASSERT_EQ(pb_tensors.size(), 1);
+  EXPECT_TRUE(pb_tensors[0].packed());
+  ASSERT_EQ(pb_tensors[0].pack_axes_size(), 1);
+  EXPECT_EQ(pb_tensors[0].pack_axes(0), 1);
+
+  auto loaded = HETensor::load_from_pb_tensors(
+      pb_tensors, *he_backend->get_ckks_encoder(), he_backend->get_context(),
+      *he_backend->get_encryptor(), *he_backend->get_decryptor(),
+      he_backend->get_encryption_parameters());
+  EXPECT_EQ(loaded->get_pack_axes(), (AxisSet{1}));
+  EXPECT_TRUE(test::all_close(read_vector<float>(loaded), values, 1e-3f));
 }
 
 TEST(he_tensor, pack) {
@@ -149,10 +246,13 @@ TEST(he_tensor, save) {
   for (size_t i = 0; i < he_tensor->data().size(); ++i) {
     EXPECT_TRUE(pb_tensor.data(i).is_plaintext());
 
-    std::vector<float> plain = {pb_tensor.data(i).plain().begin(),
-                                pb_tensor.data(i).plain().end()};
-    EXPECT_EQ(plain.size(), 1);
-    EXPECT_FLOAT_EQ(plain[0], tensor_data[i]);
+    EXPECT_EQ(pb_tensor.data(i).plain_encoding(), pb::PLAIN_F64);
+
+    const auto& plain_data = pb_tensor.data(i).plain_data();
+    EXPECT_EQ(plain_data.size(), sizeof(double));
+    double plain;
+    std::memcpy(&plain, plain_data.data(), sizeof(double));
+    EXPECT_DOUBLE_EQ(plain, tensor_data[i]);
   }
 }
 
@@ -237,6 +337,48 @@ TEST(he_tensor, load_from_context) {
                               read_vector<float>(saved_he_tensor)));
 }
 
+TEST(he_tensor, load_multi_part) {
+  auto backend = runtime::Backend::create("HE_SEAL");
+  auto he_backend = static_cast<HESealBackend*>(backend.get());
+  auto parms = HESealEncryptionParameters::default_real_packing_parms();
+  he_backend->update_encryption_parameters(parms);
+
+  Shape shape{5};
+  auto tensor = he_backend->create_cipher_tensor(element::f32, shape, false,
+                                                 "tensor_name");
+  std::vector<float> tensor_data({1, 2, 3, 4, 5});
+
+  copy_data(tensor, tensor_data);
+  auto saved_he_tensor = std::static_pointer_cast<HETensor>(tensor);
+
+  // Byte limit smaller than one ciphertext writes one value per proto tensor
+  std::vector<pb::HETensor> pb_tensors;
+  std::vector<CiphertextPayloads> payloads;
+  saved_he_tensor->write_to_pb_tensors(
+      [&](pb::HETensor&& pb_tensor, CiphertextPayloads&& tensor_payloads) {
+        pb_tensors.emplace_back(std::move(pb_tensor));
+        payloads.emplace_back(std::move(tensor_payloads));
+      },
+      seal::compr_mode_type::none, false, true, 1);
+
+  EXPECT_EQ(pb_tensors.size(), tensor_data.size());
+  for (size_t tensor_idx = 0; tensor_idx < pb_tensors.size(); ++tensor_idx) {
+    EXPECT_EQ(pb_tensors[tensor_idx].offset(), tensor_idx);
+    EXPECT_EQ(pb_tensors[tensor_idx].data_size(), 1);
+    EXPECT_EQ(payloads[tensor_idx].size(), 1);
+  }
+
+  auto loaded_he_tensor = HETensor::load_from_pb_tensors(
+      pb_tensors, *he_backend->get_ckks_encoder(), he_backend->get_context(),
+      *he_backend->get_encryptor(), *he_backend->get_decryptor(),
+      he_backend->get_encryption_parameters(), payloads);
+
+  EXPECT_TRUE(loaded_he_tensor->done_loading());
+  EXPECT_EQ(loaded_he_tensor->get_name(), saved_he_tensor->get_name());
+  EXPECT_TRUE(test::all_close(read_vector<float>(loaded_he_tensor),
+                              tensor_data, 1e-3f));
+}
+
 TEST(he_tensor, io_bounds) {
   auto backend = runtime::Backend::create("HE_SEAL");
   auto he_backend = static_cast<HESealBackend*>(backend.get());
@@ -15,13 +15,16 @@
 //*****************************************************************************
 
 #include <memory>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "he_plaintext.hpp"
 #include "he_type.hpp"
 #include "ngraph/ngraph.hpp"
+#include "protos/message.pb.h"
 #include "seal/he_seal_backend.hpp"
 #include "seal/seal_ciphertext_wrapper.hpp"
+#include "seal/seal_util.hpp"
 #include "test_util.hpp"
 #include "util/test_tools.hpp"
 
@@ -148,4 +151,88 @@ TEST(he_type, save_load) {
   }
 }
 
+TEST(he_type, save_load_plain_encoding) {
+  // Not exactly representable as a float
+  HEPlaintext plain{0.1, -1e10, 3};
+  auto he_type = HEType(plain, false);
+
+  pb::HEType pb_f64;
+  he_type.save(pb_f64);
+  EXPECT_EQ(pb_f64.plain_encoding(), pb::PLAIN_F64);
+  EXPECT_EQ(pb_f64.plain_size(), 0);
+  EXPECT_EQ(pb_f64.plain_data().size(), plain.size() * sizeof(double));
+
+  auto loaded_f64 = HEType::load(pb_f64, nullptr);
+  ASSERT_TRUE(loaded_f64.is_plaintext());
+  EXPECT_EQ(loaded_f64.get_plaintext().as_double_vec(), plain.as_double_vec());
+
+  pb::HEType pb_f32;
+  he_type.save(pb_f32, seal::compr_mode_type::none, pb::PLAIN_F32);
+  EXPECT_EQ(pb_f32.plain_encoding(), pb::PLAIN_F32);
+  EXPECT_EQ(pb_f32.plain_data().size(), plain.size() * sizeof(float));
+
+  auto loaded_f32 = HEType::load(pb_f32, nullptr);
+  ASSERT_TRUE(loaded_f32.is_plaintext());
+  for (size_t i = 0; i < plain.size(); ++i) {
+    EXPECT_FLOAT_EQ(loaded_f32.get_plaintext()[i], plain[i]);
+  }
+
+  // Values written by older peers are still read
+  pb::HEType pb_legacy;
+  pb_legacy.set_is_plaintext(true);
+  pb_legacy.add_plain(1.5);
+  pb_legacy.add_plain(2.5);
+  auto loaded_legacy = HEType::load(pb_legacy, nullptr);
+  EXPECT_EQ(loaded_legacy.get_plaintext().as_double_vec(),
+            (std::vector<double>{1.5, 2.5}));
+
+  pb::HEType pb_invalid = pb_f64;
+  pb_invalid.mutable_plain_data()->pop_back();
+  EXPECT_ANY_THROW(HEType::load(pb_invalid, nullptr));
+}
+
+TEST(he_type, save_symmetric) {
+  auto backend = runtime::Backend::create("HE_SEAL");
+  auto he_backend = static_cast<HESealBackend*>(backend.get());
+  auto context = he_backend->get_context();
+  auto& ckks_encoder = *he_backend->get_ckks_encoder();
+  double scale = he_backend->get_scale();
+
+  seal::KeyGenerator keygen(context);
+  seal::Encryptor encryptor(context, keygen.public_key(), keygen.secret_key());
+  seal::Decryptor decryptor(context, keygen.secret_key());
+
+  HEPlaintext plain{1, 2, 3};
+  bool complex_packing = false;
+  auto he_type = HEType(plain, complex_packing);
+
+  pb::HEType pb_seeded;
+  he_type.save_symmetric(pb_seeded, context->first_parms_id(), element::f32,
+                         scale, ckks_encoder, encryptor);
+  EXPECT_FALSE(pb_seeded.is_plaintext());
+  EXPECT_EQ(pb_seeded.batch_size(), plain.size());
+
+  // Seed replaces the second polynomial of a public-key encryption
+  auto cipher = HESealBackend::create_empty_ciphertext();
+  encrypt(cipher, plain, context->first_parms_id(), element::f32, scale,
+          ckks_encoder, encryptor, complex_packing);
+  pb::HEType pb_public;
+  HEType(cipher, complex_packing, plain.size()).save(pb_public);
+  EXPECT_LT(pb_seeded.ciphertext().size(), pb_public.ciphertext().size());
+
+  auto loaded = HEType::load(pb_seeded, context);
+  ASSERT_TRUE(loaded.is_ciphertext());
+  EXPECT_EQ(loaded.get_ciphertext()->ciphertext().size(), 2U);
+
+  HEPlaintext output;
+  decrypt(output, *loaded.get_ciphertext(), complex_packing, decryptor,
+          ckks_encoder, context, plain.size());
+  EXPECT_TRUE(test::all_close(output.as_double_vec(),
+                              std::vector<double>{1, 2, 3}, 1e-3));
+
+  EXPECT_ANY_THROW(loaded.save_symmetric(pb_seeded, context->first_parms_id(),
+                                         element::f32, scale, ckks_encoder,
+                                         encryptor));
+}
+
 }  // namespace ngraph::runtime::he
@@ -108,6 +108,25 @@ TEST(he_util, type_to_double) {
   EXPECT_ANY_THROW(type_to_double(nullptr, element::i8));
 }
 
+TEST(he_util, double_to_type) {
+  auto test_double_to_type = [](auto x, double value) {
+    double_to_type(value, &x, element::from<decltype(x)>());
+    EXPECT_DOUBLE_EQ(static_cast<double>(x), value);
+  };
+
+  test_double_to_type(double{0}, 10.7);
+  test_double_to_type(float{0}, 10.5);
+  test_double_to_type(int32_t{0}, -10);
+  test_double_to_type(int64_t{0}, 10);
+
+  int32_t rounded{0};
+  double_to_type(10.6, &rounded, element::i32);
+  EXPECT_EQ(rounded, 11);
+
+  // Unsupported type
+  EXPECT_ANY_THROW(double_to_type(0, nullptr, element::i8));
+}
+
 TEST(he_util, param_originates_from_name) {
   op::Parameter param{element::f32, Shape{}};
 
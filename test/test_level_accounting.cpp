@@ -0,0 +1,206 @@
+//*****************************************************************************
+// Copyright 2018-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+
+#include "gtest/gtest.h"
+#include "he_op_annotations.hpp"
+#include "ngraph/ngraph.hpp"
+#include "pass/level_accounting.hpp"
+#include "pass/propagate_he_annotations.hpp"
+#include "test_util.hpp"
+#include "util/test_tools.hpp"
+
+namespace ngraph::runtime::he {
+
+TEST(level_accounting, plain) {
+  Shape shape{2, 2};
+
+  auto a = std::make_shared<op::Parameter>(element::f32, shape);
+  auto b = std::make_shared<op::Parameter>(element::f32, shape);
+  auto t = std::make_shared<op::Multiply>(a, b);
+  auto f = std::make_shared<Function>(t, ParameterVector{a, b});
+
+  a->set_op_annotations(test::annotation_from_flags(false, false, false));
+  b->set_op_annotations(test::annotation_from_flags(false, false, false));
+
+  pass::PropagateHEAnnotations().run_on_function(f);
+  pass::LevelAccounting level_accounting;
+  level_accounting.run_on_function(f);
+
+  EXPECT_FALSE(HEOpAnnotations::rescale(*t));
+  EXPECT_EQ(HEOpAnnotations::he_op_annotation(*t)->level(), 0U);
+  EXPECT_EQ(level_accounting.levels_consumed(), 0U);
+}
+
+TEST(level_accounting, chain) {
+  Shape shape{2, 2};
+
+  auto a = std::make_shared<op::Parameter>(element::f32, shape);
+  auto b = std::make_shared<op::Parameter>(element::f32, shape);
+  auto dot = std::make_shared<op::Dot>(a, b);
+  auto add = std::make_shared<op::Add>(dot, b);
+  auto mult = std::make_shared<op::Multiply>(add, b);
+  auto f = std::make_shared<Function>(mult, ParameterVector{a, b});
+
+  a->set_op_annotations(test::annotation_from_flags(false, true, false));
+  b->set_op_annotations(test::annotation_from_flags(false, false, false));
+
+  pass::PropagateHEAnnotations().run_on_function(f);
+  pass::LevelAccounting level_accounting;
+  level_accounting.run_on_function(f);
+
+  EXPECT_TRUE(HEOpAnnotations::rescale(*dot));
+  EXPECT_FALSE(HEOpAnnotations::rescale(*add));
+  EXPECT_TRUE(HEOpAnnotations::rescale(*mult));
+
+  EXPECT_EQ(HEOpAnnotations::he_op_annotation(*dot)->level(), 1U);
+  EXPECT_EQ(HEOpAnnotations::he_op_annotation(*add)->level(), 1U);
+  EXPECT_EQ(HEOpAnnotations::he_op_annotation(*mult)->level(), 2U);
+  EXPECT_EQ(level_accounting.levels_consumed(), 2U);
+}
+
+TEST(level_accounting, refresh) {
+  Shape shape{2, 2};
+
+  auto a = std::make_shared<op::Parameter>(element::f32, shape);
+  auto b = std::make_shared<op::Parameter>(element::f32, shape);
+  auto dot1 = std::make_shared<op::Dot>(a, b);
+  auto relu = std::make_shared<op::Relu>(dot1);
+  auto dot2 = std::make_shared<op::Dot>(relu, b);
+  auto f = std::make_shared<Function>(dot2, ParameterVector{a, b});
+
+  a->set_op_annotations(test::annotation_from_flags(false, true, false));
+  b->set_op_annotations(test::annotation_from_flags(false, false, false));
+
+  pass::PropagateHEAnnotations().run_on_function(f);
+  pass::LevelAccounting level_accounting;
+  level_accounting.run_on_function(f);
+
+  EXPECT_EQ(HEOpAnnotations::he_op_annotation(*dot1)->level(), 1U);
+  EXPECT_EQ(HEOpAnnotations::he_op_annotation(*relu)->level(), 0U);
+  EXPECT_EQ(HEOpAnnotations::he_op_annotation(*dot2)->level(), 1U);
+  EXPECT_EQ(level_accounting.levels_consumed(), 1U);
+}
+
+TEST(level_accounting, max_level) {
+  Shape shape{2, 2};
+
+  auto a = std::make_shared<op::Parameter>(element::f32, shape);
+  auto b = std::make_shared<op::Parameter>(element::f32, shape);
+  auto dot1 = std::make_shared<op::Dot>(a, b);
+  auto dot2 = std::make_shared<op::Dot>(dot1, b);
+  auto dot3 = std::make_shared<op::Dot>(dot2, b);
+  auto f = std::make_shared<Function>(dot3, ParameterVector{a, b});
+
+  a->set_op_annotations(test::annotation_from_flags(false, true, false));
+  b->set_op_annotations(test::annotation_from_flags(false, false, false));
+
+  pass::PropagateHEAnnotations().run_on_function(f);
+  pass::LevelAccounting level_accounting(2);
+  level_accounting.run_on_function(f);
+
+  EXPECT_FALSE(HEOpAnnotations::refresh(*dot1));
+  EXPECT_TRUE(HEOpAnnotations::refresh(*dot2));
+  EXPECT_FALSE(HEOpAnnotations::refresh(*dot3));
+
+  EXPECT_EQ(HEOpAnnotations::he_op_annotation(*dot2)->level(), 2U);
+  EXPECT_EQ(HEOpAnnotations::he_op_annotation(*dot3)->level(), 1U);
+  EXPECT_EQ(level_accounting.levels_consumed(), 2U);
+  EXPECT_EQ(level_accounting.refresh_count(), 1U);
+}
+
+TEST(level_accounting, max_level_shared_refresh) {
+  Shape shape{2, 2};
+
+  auto a = std::make_shared<op::Parameter>(element::f32, shape);
+  auto b = std::make_shared<op::Parameter>(element::f32, shape);
+  auto mult1 = std::make_shared<op::Multiply>(a, b);
+  auto mult2 = std::make_shared<op::Multiply>(mult1, b);
+  auto mult3 = std::make_shared<op::Multiply>(mult1, a);
+  auto add = std::make_shared<op::Add>(mult2, mult3);
+  auto f = std::make_shared<Function>(add, ParameterVector{a, b});
+
+  a->set_op_annotations(test::annotation_from_flags(false, true, false));
+  b->set_op_annotations(test::annotation_from_flags(false, false, false));
+
+  pass::PropagateHEAnnotations().run_on_function(f);
+  pass::LevelAccounting level_accounting(1);
+  level_accounting.run_on_function(f);
+
+  // mult1 is refreshed once for both of its consumers
+  EXPECT_TRUE(HEOpAnnotations::refresh(*mult1));
+  EXPECT_FALSE(HEOpAnnotations::refresh(*mult2));
+  EXPECT_FALSE(HEOpAnnotations::refresh(*mult3));
+
+  EXPECT_EQ(HEOpAnnotations::he_op_annotation(*mult2)->level(), 1U);
+  EXPECT_EQ(HEOpAnnotations::he_op_annotation(*mult3)->level(), 1U);
+  EXPECT_EQ(HEOpAnnotations::he_op_annotation(*add)->level(), 1U);
+  EXPECT_EQ(level_accounting.levels_consumed(), 1U);
+  EXPECT_EQ(level_accounting.refresh_count(), 1U);
+}
+
+TEST(level_accounting, max_level_client_refresh) {
+  Shape shape{2, 2};
+
+  auto a = std::make_shared<op::Parameter>(element::f32, shape);
+  auto b = std::make_shared<op::Parameter>(element::f32, shape);
+  auto dot1 = std::make_shared<op::Dot>(a, b);
+  auto relu = std::make_shared<op::Relu>(dot1);
+  auto dot2 = std::make_shared<op::Dot>(relu, b);
+  auto f = std::make_shared<Function>(dot2, ParameterVector{a, b});
+
+  a->set_op_annotations(test::annotation_from_flags(false, true, false));
+  b->set_op_annotations(test::annotation_from_flags(false, false, false));
+
+  pass::PropagateHEAnnotations().run_on_function(f);
+  pass::LevelAccounting level_accounting(1);
+  level_accounting.run_on_function(f);
+
+  // The Relu round-trip already refreshes its output
+  EXPECT_FALSE(HEOpAnnotations::refresh(*dot1));
+  EXPECT_FALSE(HEOpAnnotations::refresh(*relu));
+  EXPECT_EQ(level_accounting.levels_consumed(), 1U);
+  EXPECT_EQ(level_accounting.refresh_count(), 0U);
+}
+
+TEST(level_accounting, max_level_client_op_refresh) {
+  Shape shape{2, 2};
+
+  auto a = std::make_shared<op::Parameter>(element::f32, shape);
+  auto b = std::make_shared<op::Parameter>(element::f32, shape);
+  auto dot1 = std::make_shared<op::Dot>(a, b);
+  auto sigmoid = std::make_shared<op::Sigmoid>(dot1);
+  auto dot2 = std::make_shared<op::Dot>(sigmoid, b);
+  auto f = std::make_shared<Function>(dot2, ParameterVector{a, b});
+
+  a->set_op_annotations(test::annotation_from_flags(false, true, false));
+  b->set_op_annotations(test::annotation_from_flags(false, false, false));
+
+  pass::PropagateHEAnnotations().run_on_function(f);
+  pass::LevelAccounting level_accounting(1, {"Sigmoid"});
+  level_accounting.run_on_function(f);
+
+  // The Sigmoid is evaluated by the client, so already refreshes its output
+  EXPECT_TRUE(level_accounting.is_refresh_op(*sigmoid));
+  EXPECT_FALSE(HEOpAnnotations::refresh(*dot1));
+  EXPECT_FALSE(HEOpAnnotations::refresh(*sigmoid));
+  EXPECT_EQ(HEOpAnnotations::he_op_annotation(*sigmoid)->level(), 0U);
+  EXPECT_EQ(HEOpAnnotations::he_op_annotation(*dot2)->level(), 1U);
+  EXPECT_EQ(level_accounting.refresh_count(), 0U);
+}
+
+}  // namespace ngraph::runtime::he
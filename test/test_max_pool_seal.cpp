@@ -0,0 +1,61 @@
+//*****************************************************************************
+// Copyright 2018-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "seal/kernel/max_pool_seal.hpp"
+
+namespace ngraph::runtime::he {
+TEST(max_pool_seal, group_max_lists) {
+  // Overlapping windows of size 2, with stride 1
+  std::vector<std::vector<size_t>> max_lists{
+      {0, 1}, {1, 2}, {2, 3}, {3, 4}, {4, 5}};
+
+  auto groups = group_max_lists(max_lists, 3);
+  ASSERT_EQ(groups.size(), 3);
+
+  EXPECT_EQ(groups[0].arg_indices, (std::vector<size_t>{0, 1, 2}));
+  EXPECT_EQ(groups[0].windows,
+            (std::vector<std::vector<size_t>>{{0, 1}, {1, 2}}));
+  EXPECT_EQ(groups[1].arg_indices, (std::vector<size_t>{2, 3, 4}));
+  EXPECT_EQ(groups[1].windows,
+            (std::vector<std::vector<size_t>>{{0, 1}, {1, 2}}));
+  EXPECT_EQ(groups[2].arg_indices, (std::vector<size_t>{4, 5}));
+  EXPECT_EQ(groups[2].windows, (std::vector<std::vector<size_t>>{{0, 1}}));
+
+  groups = group_max_lists(max_lists, 4);
+  ASSERT_EQ(groups.size(), 2);
+  EXPECT_EQ(groups[0].arg_indices, (std::vector<size_t>{0, 1, 2, 3}));
+  EXPECT_EQ(groups[0].windows.size(), 3);
+  EXPECT_EQ(groups[1].arg_indices, (std::vector<size_t>{3, 4, 5}));
+  EXPECT_EQ(groups[1].windows.size(), 2);
+
+  groups = group_max_lists(max_lists, 6);
+  ASSERT_EQ(groups.size(), 1);
+  EXPECT_EQ(groups[0].arg_indices.size(), 6);
+  EXPECT_EQ(groups[0].windows, max_lists);
+
+  // Groups are also bounded by window count
+  groups = group_max_lists({{0, 1}, {0, 1}, {0, 1}}, 2);
+  ASSERT_EQ(groups.size(), 2);
+  EXPECT_EQ(groups[0].windows.size(), 2);
+  EXPECT_EQ(groups[1].windows.size(), 1);
+
+  EXPECT_ANY_THROW(group_max_lists(max_lists, 1));
+  EXPECT_TRUE(group_max_lists({}, 1).empty());
+}
+}  // namespace ngraph::runtime::he
@@ -18,6 +18,7 @@
 #include "seal/he_seal_backend.hpp"
 #include "seal/he_seal_encryption_parameters.hpp"
 #include "seal/seal.h"
+#include "seal/seal_codec.hpp"
 #include "seal/seal_util.hpp"
 #include "test_util.hpp"
 #include "util/all_close.hpp"
@@ -220,4 +221,44 @@ TEST(perf_micro, encode) {
   }
 }
 
+TEST(perf_micro, codec) {
+  auto backend = runtime::Backend::create("HE_SEAL");
+  auto he_backend = static_cast<HESealBackend*>(backend.get());
+  auto context = he_backend->get_context();
+
+  size_t test_cnt = 20;
+  HEPlaintext plain(he_backend->get_ckks_encoder()->slot_count(), 1.5);
+  auto cipher = HESealBackend::create_empty_ciphertext();
+  he_backend->encrypt(cipher, plain, element::f32, false);
+
+  for (pb::Codec codec : std::vector<pb::Codec>{pb::CODEC_NONE,
+                                                pb::CODEC_DEFLATE}) {
+    if (!codec_supported(codec)) {
+      continue;
+    }
+    auto compr_mode = codec_to_compr_mode(codec);
+
+    std::chrono::nanoseconds time_save_sum(0);
+    std::chrono::nanoseconds time_load_sum(0);
+    size_t byte_count = 0;
+    for (size_t i = 0; i < test_cnt; ++i) {
+      pb::HEType pb_he_type;
+      auto time_start = std::chrono::high_resolution_clock::now();
+      cipher->save(pb_he_type, compr_mode);
+      auto time_end = std::chrono::high_resolution_clock::now();
+      time_save_sum += time_end - time_start;
+      byte_count = pb_he_type.ciphertext().size();
+
+      time_start = std::chrono::high_resolution_clock::now();
+      auto loaded = HEType::load(pb_he_type, context);
+      time_end = std::chrono::high_resolution_clock::now();
+      time_load_sum += time_end - time_start;
+    }
+    NGRAPH_INFO << "codec " << codec_name(codec);
+    NGRAPH_INFO << "ciphertext bytes " << byte_count;
+    NGRAPH_INFO << "time_save_avg (ns) " << time_save_sum.count() / test_cnt;
+    NGRAPH_INFO << "time_load_avg (ns) " << time_load_sum.count() / test_cnt;
+  }
+}
+
 }  // namespace ngraph::runtime::he
@@ -0,0 +1,113 @@
+//*****************************************************************************
+// Copyright 2018-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+
+#include "gtest/gtest.h"
+#include "tcp/round_trip_batcher.hpp"
+
+namespace ngraph::runtime::he {
+
+namespace {
+/// \brief Runs batches of a round-trip over a simulated link, which delivers
+/// bytes at a fixed rate after a fixed latency
+/// \returns Batch byte count chosen after the batches
+size_t simulate_link(RoundTripBatcher& batcher, double bytes_per_second,
+                     std::chrono::microseconds fixed_latency,
+                     size_t batch_count) {
+  using clock = RoundTripBatcher::clock;
+  auto start = clock::time_point{};
+  auto now = start;
+  auto link_free = start;
+  std::deque<clock::time_point> finish_times;
+  size_t element_byte_count = 1024;
+
+  for (size_t batch_idx = 0; batch_idx < batch_count; ++batch_idx) {
+    if (!batcher.can_start_batch()) {
+      now = finish_times.front();
+      finish_times.pop_front();
+      batcher.finish_batch(now);
+    }
+    size_t byte_count = batcher.batch_size(element_byte_count) *
+                        element_byte_count;
+    auto transfer_time =
+        std::chrono::duration_cast<clock::duration>(std::chrono::duration<
+            double>(byte_count / bytes_per_second));
+    link_free = std::max(link_free, now) + transfer_time;
+    batcher.start_batch(byte_count / element_byte_count, byte_count, now);
+    finish_times.push_back(link_free + fixed_latency);
+  }
+  while (!finish_times.empty()) {
+    batcher.finish_batch(finish_times.front());
+    finish_times.pop_front();
+  }
+  return batcher.batch_byte_count();
+}
+}  // namespace
+
+TEST(round_trip_batcher, in_flight_count) {
+  RoundTripBatcher batcher(1UL << 30, 2);
+  EXPECT_EQ(batcher.batch_size(1024),
+            RoundTripBatcher::initial_batch_byte_count / 1024);
+  EXPECT_EQ(batcher.batch_size(1UL << 30), 1U);
+
+  batcher.start_batch(1, 1024);
+  batcher.start_batch(1, 1024);
+  EXPECT_FALSE(batcher.can_start_batch());
+  EXPECT_EQ(batcher.in_flight_count(), 2U);
+
+  batcher.finish_batch();
+  EXPECT_TRUE(batcher.can_start_batch());
+  ASSERT_EQ(batcher.metrics().size(), 1U);
+  EXPECT_EQ(batcher.metrics()[0].element_count, 1U);
+  EXPECT_EQ(batcher.metrics()[0].byte_count, 1024U);
+}
+
+TEST(round_trip_batcher, adapts_to_bandwidth_delay) {
+  double bytes_per_second = 1e8;
+
+  // A short round-trip is covered by small batches
+  RoundTripBatcher short_batcher(1UL << 30);
+  size_t short_byte_count = simulate_link(short_batcher, bytes_per_second,
+                                          std::chrono::milliseconds(1), 200);
+  EXPECT_LT(short_byte_count, RoundTripBatcher::initial_batch_byte_count);
+
+  // A long round-trip needs larger batches to keep the link busy
+  RoundTripBatcher long_batcher(1UL << 30);
+  size_t long_byte_count = simulate_link(long_batcher, bytes_per_second,
+                                         std::chrono::milliseconds(200), 200);
+  EXPECT_GT(long_byte_count, RoundTripBatcher::initial_batch_byte_count);
+
+  // Batches never exceed the maximum size
+  RoundTripBatcher capped_batcher(1UL << 20);
+  EXPECT_LE(simulate_link(capped_batcher, bytes_per_second,
+                          std::chrono::milliseconds(200), 200),
+            1UL << 20);
+  EXPECT_EQ(capped_batcher.metrics().size(), 200U);
+}
+
+TEST(round_trip_batcher, metrics_window) {
+  RoundTripBatcher batcher(1UL << 20);
+  size_t batch_count = RoundTripBatcher::metrics_window + 100;
+  simulate_link(batcher, 1e8, std::chrono::milliseconds(1), batch_count);
+
+  // Only the most recent batches are kept
+  EXPECT_EQ(batcher.metrics().size(), RoundTripBatcher::metrics_window);
+}
+
+}  // namespace ngraph::runtime::he
@@ -0,0 +1,120 @@
+//*****************************************************************************
+// Copyright 2018-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "he_tensor.hpp"
+#include "ngraph/ngraph.hpp"
+#include "seal/he_seal_backend.hpp"
+#include "seal/seal.h"
+#include "seal/seal_ciphertext_slab.hpp"
+#include "test_util.hpp"
+#include "util/test_tools.hpp"
+
+namespace ngraph::runtime::he {
+
+TEST(seal_ciphertext_slab, get_for_byte_count) {
+  SealCiphertextSlab slab(2, 1024);
+  EXPECT_EQ(slab.item_count(), 2U);
+  EXPECT_EQ(slab.alloc_byte_count(), 2048U);
+  EXPECT_EQ(slab.free_count(), 2U);
+
+  auto first = slab.get_for_byte_count(1024);
+  auto second = slab.get_for_byte_count(512);
+  EXPECT_EQ(first.get(), slab.data());
+  EXPECT_EQ(second.get(), slab.data() + 1024);
+  EXPECT_EQ(slab.free_count(), 0U);
+
+  // Slab is full
+  auto full = slab.get_for_byte_count(1024);
+  EXPECT_FALSE(slab.contains(full.get()));
+
+  // Allocation is too large
+  second.release();
+  auto large = slab.get_for_byte_count(2048);
+  EXPECT_FALSE(slab.contains(large.get()));
+  EXPECT_EQ(slab.free_count(), 1U);
+
+  auto reused = slab.get_for_byte_count(1024);
+  EXPECT_EQ(reused.get(), slab.data() + 1024);
+}
+
+TEST(seal_ciphertext_slab, cipher_tensor) {
+  auto backend = runtime::Backend::create("HE_SEAL");
+  auto he_backend = static_cast<HESealBackend*>(backend.get());
+  he_backend->slab_storage() = true;
+
+  Shape shape{2, 3};
+  auto tensor =
+      std::static_pointer_cast<HETensor>(he_backend->create_cipher_tensor(
+          element::f32, shape, false));
+  EXPECT_TRUE(tensor->slab_storage());
+  EXPECT_FALSE(tensor->slab_allocated());
+
+  std::vector<float> values{1, 2, 3, 4, 5, 6};
+  copy_data(tensor, values);
+  ASSERT_TRUE(tensor->slab_allocated());
+
+  auto& slab = dynamic_cast<SealCiphertextSlab&>(
+      static_cast<seal::util::MemoryPool&>(tensor->slab_pool()));
+  EXPECT_EQ(slab.item_count(), shape_size(shape));
+  EXPECT_EQ(slab.free_count(), 0U);
+  for (auto& he_type : tensor->data()) {
+    ASSERT_TRUE(he_type.is_ciphertext());
+    EXPECT_TRUE(slab.contains(he_type.get_ciphertext()->ciphertext().data()));
+  }
+  EXPECT_TRUE(test::all_close(read_vector<float>(tensor), values, 1e-3f));
+
+  // Overwriting the tensor re-uses the slots of the previous ciphertexts
+  copy_data(tensor, values);
+  EXPECT_EQ(slab.free_count(), 0U);
+  EXPECT_TRUE(test::all_close(read_vector<float>(tensor), values, 1e-3f));
+
+  tensor->data().clear();
+  EXPECT_EQ(slab.free_count(), shape_size(shape));
+}
+
+TEST(seal_ciphertext_slab, kernel_output) {
+  auto backend = runtime::Backend::create("HE_SEAL");
+  auto he_backend = static_cast<HESealBackend*>(backend.get());
+  he_backend->slab_storage() = true;
+
+  Shape shape{2, 3};
+  auto a = std::make_shared<op::Parameter>(element::f32, shape);
+  auto b = std::make_shared<op::Parameter>(element::f32, shape);
+  auto t = std::make_shared<op::Add>(a, b);
+  auto f = std::make_shared<Function>(t, ParameterVector{a, b});
+
+  auto t_a = he_backend->create_cipher_tensor(element::f32, shape);
+  auto t_b = he_backend->create_cipher_tensor(element::f32, shape);
+  auto t_result = std::static_pointer_cast<HETensor>(
+      he_backend->create_cipher_tensor(element::f32, shape));
+  copy_data(t_a, std::vector<float>{1, 2, 3, 4, 5, 6});
+  copy_data(t_b, std::vector<float>{7, 8, 9, 10, 11, 12});
+
+  auto handle = backend->compile(f);
+  handle->call_with_validate({t_result}, {t_a, t_b});
+
+  // Kernels replace the output ciphertexts, so no slab is allocated for them
+  EXPECT_FALSE(t_result->slab_allocated());
+  EXPECT_TRUE(test::all_close(read_vector<float>(t_result),
+                              std::vector<float>{8, 10, 12, 14, 16, 18},
+                              1e-3f));
+}
+
+}  // namespace ngraph::runtime::he
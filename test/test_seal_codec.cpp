@@ -0,0 +1,99 @@
+//*****************************************************************************
+// Copyright 2018-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "he_plaintext.hpp"
+#include "he_type.hpp"
+#include "ngraph/ngraph.hpp"
+#include "protos/message.pb.h"
+#include "seal/he_seal_backend.hpp"
+#include "seal/seal.h"
+#include "seal/seal_ciphertext_wrapper.hpp"
+#include "seal/seal_codec.hpp"
+#include "seal/seal_util.hpp"
+#include "test_util.hpp"
+#include "util/test_tools.hpp"
+
+namespace ngraph::runtime::he {
+
+TEST(seal_codec, parse_codec) {
+  EXPECT_EQ(parse_codec("none"), pb::CODEC_NONE);
+  EXPECT_EQ(parse_codec("DEFLATE"), pb::CODEC_DEFLATE);
+  EXPECT_ANY_THROW(parse_codec("unknown"));
+
+  EXPECT_EQ(codec_name(pb::CODEC_NONE), "none");
+  EXPECT_EQ(codec_name(pb::CODEC_DEFLATE), "deflate");
+  EXPECT_TRUE(codec_supported(pb::CODEC_NONE));
+}
+
+TEST(seal_codec, offered_codecs) {
+  EXPECT_EQ(offered_codecs(pb::CODEC_NONE),
+            std::vector<pb::Codec>{pb::CODEC_NONE});
+  if (codec_supported(pb::CODEC_DEFLATE)) {
+    EXPECT_EQ(offered_codecs(pb::CODEC_DEFLATE),
+              (std::vector<pb::Codec>{pb::CODEC_DEFLATE, pb::CODEC_NONE}));
+  } else {
+    EXPECT_EQ(offered_codecs(pb::CODEC_DEFLATE),
+              std::vector<pb::Codec>{pb::CODEC_NONE});
+  }
+}
+
+TEST(seal_codec, negotiate_codec) {
+  pb::EncryptionParameters pb_params;
+  EXPECT_EQ(negotiate_codec(pb_params), pb::CODEC_NONE);
+
+  pb_params.add_codecs(pb::CODEC_DEFLATE);
+  pb_params.add_codecs(pb::CODEC_NONE);
+  EXPECT_EQ(negotiate_codec(pb_params), codec_supported(pb::CODEC_DEFLATE)
+                                            ? pb::CODEC_DEFLATE
+                                            : pb::CODEC_NONE);
+}
+
+TEST(seal_codec, save_load) {
+  auto backend = runtime::Backend::create("HE_SEAL");
+  auto he_backend = static_cast<HESealBackend*>(backend.get());
+  auto context = he_backend->get_context();
+
+  if (!codec_supported(pb::CODEC_DEFLATE)) {
+    NGRAPH_INFO << "SEAL built without zlib; skipping deflate test";
+    return;
+  }
+
+  HEPlaintext plain{1, 2, 3};
+  auto cipher = HESealBackend::create_empty_ciphertext();
+  he_backend->encrypt(cipher, plain, element::f32, false);
+
+  pb::HEType pb_uncompressed;
+  cipher->save(pb_uncompressed);
+
+  pb::HEType pb_compressed;
+  cipher->save(pb_compressed, codec_to_compr_mode(pb::CODEC_DEFLATE));
+  EXPECT_LT(pb_compressed.ciphertext().size(),
+            pb_uncompressed.ciphertext().size());
+
+  auto loaded = HEType::load(pb_compressed, context);
+  ASSERT_TRUE(loaded.is_ciphertext());
+
+  HEPlaintext output;
+  he_backend->decrypt(output, *loaded.get_ciphertext(), plain.size(), false);
+  EXPECT_TRUE(test::all_close(output.as_double_vec(),
+                              std::vector<double>{1, 2, 3}, 1e-3));
+}
+
+}  // namespace ngraph::runtime::he
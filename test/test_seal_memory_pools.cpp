@@ -0,0 +1,65 @@
+//*****************************************************************************
+// Copyright 2018-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <set>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "seal/seal.h"
+#include "seal/seal_memory_pools.hpp"
+
+namespace ngraph::runtime::he {
+
+TEST(seal_memory_pools, create) {
+  SealMemoryPools pools(4);
+  EXPECT_EQ(pools.size(), 4U);
+  EXPECT_EQ(pools.alloc_byte_count(), 0U);
+
+  SealMemoryPools default_pools;
+  EXPECT_EQ(default_pools.size(), SealMemoryPools::max_threads());
+}
+
+TEST(seal_memory_pools, global) {
+  const auto& pools = SealMemoryPools::global();
+  EXPECT_EQ(pools.size(), 0U);
+  EXPECT_TRUE(pools.thread_pool() == seal::MemoryManager::GetPool());
+}
+
+TEST(seal_memory_pools, thread_pool) {
+  SealMemoryPools pools;
+
+  // Outside a parallel region, the first pool is used
+  EXPECT_FALSE(pools.thread_pool() == seal::MemoryManager::GetPool());
+
+  std::vector<const seal::MemoryPoolHandle*> thread_pools(pools.size());
+#pragma omp parallel for
+  for (size_t i = 0; i < thread_pools.size(); ++i) {
+    thread_pools[i] = &pools.thread_pool();
+  }
+  for (const auto* pool : thread_pools) {
+    EXPECT_FALSE(*pool == seal::MemoryManager::GetPool());
+  }
+}
+
+TEST(seal_memory_pools, alloc_byte_count) {
+  SealMemoryPools pools(1);
+  size_t coeff_count = 1024;
+  seal::Plaintext plain(coeff_count, pools.thread_pool());
+
+  EXPECT_GE(pools.alloc_byte_count(), coeff_count * sizeof(std::uint64_t));
+}
+
+}  // namespace ngraph::runtime::he
@@ -0,0 +1,220 @@
+//*****************************************************************************
+// Copyright 2018-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <limits>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "seal/seal.h"
+#include "seal/seal_simd.hpp"
+#include "seal/util/polyarithsmallmod.h"
+
+namespace ngraph::runtime::he {
+
+namespace {
+// Instruction set extensions supported by the CPU running the test
+std::vector<SIMDLevel> supported_simd_levels() {
+  std::vector<SIMDLevel> levels{SIMDLevel::scalar};
+  if (simd_level() == SIMDLevel::avx2 || simd_level() == SIMDLevel::avx512) {
+    levels.emplace_back(SIMDLevel::avx2);
+  }
+  if (simd_level() == SIMDLevel::avx512) {
+    levels.emplace_back(SIMDLevel::avx512);
+  }
+  return levels;
+}
+
+std::vector<seal::SmallModulus> test_moduli() {
+  return seal::CoeffModulus::Create(8192, {20, 30, 32, 50, 60});
+}
+}  // namespace
+
+TEST(seal_simd, simd_level) {
+  std::stringstream ss;
+  ss << simd_level();
+  EXPECT_FALSE(ss.str().empty());
+}
+
+TEST(seal_simd, add_poly_scalar_coeffmod) {
+  std::mt19937_64 rng(0);
+  // Odd size exercises the scalar tail of the vectorized loops
+  const size_t coeff_count = 1029;
+  for (const auto& modulus : test_moduli()) {
+    std::vector<uint64_t> poly(coeff_count);
+    for (auto& coeff : poly) {
+      coeff = rng() % modulus.value();
+    }
+    uint64_t scalar = rng() % modulus.value();
+
+    for (const auto level : supported_simd_levels()) {
+      std::vector<uint64_t> result(coeff_count);
+      add_poly_scalar_coeffmod_simd(poly.data(), coeff_count, scalar, modulus,
+                                    result.data(), level);
+      for (size_t k = 0; k < coeff_count; ++k) {
+        EXPECT_EQ(result[k], (poly[k] + scalar) % modulus.value());
+      }
+    }
+  }
+}
+
+TEST(seal_simd, multiply_poly_scalar_coeffmod) {
+  std::mt19937_64 rng(1);
+  const size_t coeff_count = 1029;
+  for (const auto& modulus : test_moduli()) {
+    std::vector<uint64_t> poly(coeff_count);
+    for (auto& coeff : poly) {
+      coeff = rng() % modulus.value();
+    }
+    uint64_t scalar = rng() % modulus.value();
+
+    std::vector<uint64_t> expected(coeff_count);
+    seal::util::multiply_poly_scalar_coeffmod(poly.data(), coeff_count, scalar,
+                                              modulus, expected.data());
+    for (const auto level : supported_simd_levels()) {
+      std::vector<uint64_t> result(poly);
+      // In-place
+      multiply_poly_scalar_coeffmod_simd(result.data(), coeff_count, scalar,
+                                         modulus, result.data(), level);
+      EXPECT_EQ(result, expected);
+    }
+  }
+}
+
+TEST(seal_simd, multiply_poly_scalar_lazy) {
+  std::mt19937_64 rng(2);
+  const size_t coeff_count = 1029;
+  for (const auto& modulus : test_moduli()) {
+    std::vector<uint64_t> poly(coeff_count);
+    for (auto& coeff : poly) {
+      coeff = rng() % modulus.value();
+    }
+    uint64_t scalar = rng() % modulus.value();
+
+    for (const auto level : supported_simd_levels()) {
+      std::vector<uint64_t> result(coeff_count);
+      multiply_poly_scalar_lazy_simd(poly.data(), coeff_count, scalar, modulus,
+                                     result.data(), level);
+      for (size_t k = 0; k < coeff_count; ++k) {
+        EXPECT_EQ(result[k], poly[k] * scalar);
+      }
+    }
+  }
+}
+
+TEST(seal_simd, multiply_add_poly_scalar_coeffmod) {
+  std::mt19937_64 rng(4);
+  const size_t coeff_count = 1029;
+  for (const auto& modulus : test_moduli()) {
+    std::vector<uint64_t> poly(coeff_count);
+    std::vector<uint64_t> acc(coeff_count);
+    for (size_t k = 0; k < coeff_count; ++k) {
+      poly[k] = rng() % modulus.value();
+      acc[k] = rng() % modulus.value();
+    }
+    uint64_t scalar = rng() % modulus.value();
+
+    std::vector<uint64_t> expected(coeff_count);
+    seal::util::multiply_poly_scalar_coeffmod(poly.data(), coeff_count, scalar,
+                                              modulus, expected.data());
+    seal::util::add_poly_poly_coeffmod(expected.data(), acc.data(),
+                                       coeff_count, modulus, expected.data());
+    for (const auto level : supported_simd_levels()) {
+      std::vector<uint64_t> result(acc);
+      multiply_add_poly_scalar_coeffmod_simd(poly.data(), coeff_count, scalar,
+                                             modulus, result.data(), level);
+      EXPECT_EQ(result, expected);
+    }
+  }
+}
+
+TEST(seal_simd, multiply_add_poly_scalar_lazy) {
+  std::mt19937_64 rng(5);
+  const size_t coeff_count = 1029;
+  for (const auto& modulus : test_moduli()) {
+    std::vector<uint64_t> poly(coeff_count);
+    std::vector<uint64_t> acc(coeff_count);
+    for (size_t k = 0; k < coeff_count; ++k) {
+      poly[k] = rng() % modulus.value();
+      acc[k] = rng() % modulus.value();
+    }
+    uint64_t scalar = rng() % modulus.value();
+
+    for (const auto level : supported_simd_levels()) {
+      std::vector<uint64_t> result(acc);
+      multiply_add_poly_scalar_lazy_simd(poly.data(), coeff_count, scalar,
+                                         modulus, result.data(), level);
+      for (size_t k = 0; k < coeff_count; ++k) {
+        EXPECT_EQ(result[k], acc[k] + poly[k] * scalar);
+      }
+    }
+  }
+}
+
+TEST(seal_simd, lazy_unreduced) {
+  std::mt19937_64 rng(6);
+  const size_t coeff_count = 1029;
+  for (const auto& modulus : test_moduli()) {
+    // Coefficients of an unreduced sum are less than twice the modulus
+    std::vector<uint64_t> poly(coeff_count);
+    std::vector<uint64_t> acc(coeff_count);
+    for (size_t k = 0; k < coeff_count; ++k) {
+      poly[k] = rng() % (2 * modulus.value());
+      acc[k] = rng() % modulus.value();
+    }
+    poly[0] = 2 * modulus.value() - 1;
+    uint64_t scalar = rng() % modulus.value();
+
+    for (const auto level : supported_simd_levels()) {
+      std::vector<uint64_t> product(coeff_count);
+      multiply_poly_scalar_lazy_simd(poly.data(), coeff_count, scalar, modulus,
+                                     product.data(), level);
+      std::vector<uint64_t> sum(acc);
+      multiply_add_poly_scalar_lazy_simd(poly.data(), coeff_count, scalar,
+                                         modulus, sum.data(), level);
+      for (size_t k = 0; k < coeff_count; ++k) {
+        EXPECT_EQ(product[k], poly[k] * scalar);
+        EXPECT_EQ(sum[k], acc[k] + poly[k] * scalar);
+      }
+    }
+  }
+}
+
+TEST(seal_simd, reduce_poly_coeffmod) {
+  std::mt19937_64 rng(3);
+  const size_t coeff_count = 1029;
+  for (const auto& modulus : test_moduli()) {
+    // Unreduced coefficients may take any 64-bit value
+    std::vector<uint64_t> poly(coeff_count);
+    for (auto& coeff : poly) {
+      coeff = rng();
+    }
+    poly[0] = 0;
+    poly[1] = std::numeric_limits<uint64_t>::max();
+
+    for (const auto level : supported_simd_levels()) {
+      std::vector<uint64_t> result(coeff_count);
+      reduce_poly_coeffmod_simd(poly.data(), coeff_count, modulus,
+                                result.data(), level);
+      for (size_t k = 0; k < coeff_count; ++k) {
+        EXPECT_EQ(result[k], poly[k] % modulus.value());
+      }
+    }
+  }
+}
+
+}  // namespace ngraph::runtime::he
@@ -309,6 +309,45 @@ TEST(seal_util, multiply_plain_inplace_large_coeff) {
   multiply_plain_inplace(cipher1->ciphertext(), 1.23, *he_backend);
 }
 
+TEST(seal_util, fma_plain_inplace) {
+  auto backend = runtime::Backend::create("HE_SEAL");
+  auto he_backend = static_cast<HESealBackend*>(backend.get());
+  HEPlaintext plain{1, 2, 3};
+  bool complex_packing = false;
+  auto context = he_backend->get_context();
+
+  auto cipher1 = HESealBackend::create_empty_ciphertext();
+  auto cipher2 = HESealBackend::create_empty_ciphertext();
+  encrypt(cipher1, plain, context->first_parms_id(), element::f32,
+          he_backend->get_scale(), *he_backend->get_ckks_encoder(),
+          *he_backend->get_encryptor(), complex_packing);
+  encrypt(cipher2, plain, context->first_parms_id(), element::f32,
+          he_backend->get_scale(), *he_backend->get_ckks_encoder(),
+          *he_backend->get_encryptor(), complex_packing);
+
+  // acc = 2 * plain + 3 * plain
+  auto acc = HESealBackend::create_empty_ciphertext();
+  multiply_plain(cipher1->ciphertext(), 2.0, acc->ciphertext(), *he_backend);
+  fma_plain_inplace(acc->ciphertext(), cipher2->ciphertext(), 3.0,
+                    *he_backend);
+
+  HEPlaintext output;
+  decrypt(output, *acc, complex_packing, *he_backend->get_decryptor(),
+          *he_backend->get_ckks_encoder(), context, plain.size());
+  EXPECT_TRUE(test::all_close(output.as_double_vec(),
+                              std::vector<double>{5, 10, 15}, 1e-3));
+
+  // Accumulator scale does not match product scale
+  EXPECT_ANY_THROW(fma_plain_inplace(cipher1->ciphertext(),
+                                     cipher2->ciphertext(), 3.0, *he_backend));
+
+  // Accumulator level does not match ciphertext level
+  he_backend->get_evaluator()->mod_switch_to_next_inplace(
+      cipher2->ciphertext());
+  EXPECT_ANY_THROW(fma_plain_inplace(acc->ciphertext(), cipher2->ciphertext(),
+                                     3.0, *he_backend));
+}
+
 TEST(seal_util, match_to_smallest_chain_index) {
   auto backend = runtime::Backend::create("HE_SEAL");
   auto he_backend = static_cast<HESealBackend*>(backend.get());
@@ -329,6 +368,41 @@ TEST(seal_util, match_to_smallest_chain_index) {
   }
 }
 
+TEST(seal_util, mod_switch_to_lowest) {
+  auto backend = runtime::Backend::create("HE_SEAL");
+  auto he_backend = static_cast<HESealBackend*>(backend.get());
+  auto context = he_backend->get_context();
+  HEPlaintext plain{1, 2, 3};
+  bool complex_packing = false;
+
+  auto cipher = HESealBackend::create_empty_ciphertext();
+  encrypt(cipher, plain, context->first_parms_id(), element::f32,
+          he_backend->get_scale(), *he_backend->get_ckks_encoder(),
+          *he_backend->get_encryptor(), complex_packing);
+  size_t byte_count = cipher->byte_count();
+
+  std::vector<HEType> he_types{HEType(cipher, complex_packing, plain.size()),
+                               HEType(plain, complex_packing)};
+  mod_switch_to_lowest(he_types, *he_backend);
+
+  // Shared ciphertext is unchanged
+  EXPECT_EQ(cipher->ciphertext().parms_id(), context->first_parms_id());
+
+  const auto& switched = he_types[0].get_ciphertext();
+  EXPECT_NE(switched, cipher);
+  EXPECT_EQ(switched->ciphertext().parms_id(), context->last_parms_id());
+  if (context->first_parms_id() != context->last_parms_id()) {
+    EXPECT_LT(switched->byte_count(), byte_count);
+  }
+  EXPECT_TRUE(he_types[1].is_plaintext());
+
+  HEPlaintext output;
+  decrypt(output, *switched, complex_packing, *he_backend->get_decryptor(),
+          *he_backend->get_ckks_encoder(), context, plain.size());
+  EXPECT_TRUE(test::all_close(output.as_double_vec(), plain.as_double_vec(),
+                              1e-3));
+}
+
 TEST(seal_util, encode_invalid) {
   auto backend = runtime::Backend::create("HE_SEAL");
   auto he_backend = static_cast<HESealBackend*>(backend.get());
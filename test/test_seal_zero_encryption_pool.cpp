@@ -0,0 +1,97 @@
+//*****************************************************************************
+// Copyright 2018-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "he_plaintext.hpp"
+#include "ngraph/ngraph.hpp"
+#include "seal/he_seal_backend.hpp"
+#include "seal/seal.h"
+#include "seal/seal_util.hpp"
+#include "seal/seal_zero_encryption_pool.hpp"
+#include "test_util.hpp"
+#include "util/test_tools.hpp"
+
+namespace ngraph::runtime::he {
+
+TEST(seal_zero_encryption_pool, fill) {
+  auto backend = runtime::Backend::create("HE_SEAL");
+  auto he_backend = static_cast<HESealBackend*>(backend.get());
+  auto context = he_backend->get_context();
+
+  SealZeroEncryptionPool pool(context, *he_backend->get_encryptor(),
+                              context->first_parms_id(), 4, 2);
+  EXPECT_EQ(pool.capacity(), 4U);
+  pool.wait_until_full();
+  EXPECT_EQ(pool.size(), 4U);
+
+  seal::Ciphertext zero;
+  pool.get(zero);
+  EXPECT_EQ(zero.parms_id(), context->first_parms_id());
+  EXPECT_EQ(pool.miss_count(), 0U);
+
+  // Pool refills in the background
+  pool.wait_until_full();
+  EXPECT_EQ(pool.size(), 4U);
+}
+
+TEST(seal_zero_encryption_pool, encrypt) {
+  auto backend = runtime::Backend::create("HE_SEAL");
+  auto he_backend = static_cast<HESealBackend*>(backend.get());
+  auto context = he_backend->get_context();
+
+  for (bool complex_packing : std::vector<bool>{false, true}) {
+    SealZeroEncryptionPool pool(context, *he_backend->get_encryptor(),
+                                context->first_parms_id(), 2);
+    pool.wait_until_full();
+
+    HEPlaintext plain{1, 2, 3};
+    // More encryptions than the pool's capacity
+    for (size_t i = 0; i < 4; ++i) {
+      auto cipher = HESealBackend::create_empty_ciphertext();
+      encrypt(cipher, plain, context->first_parms_id(), element::f32,
+              he_backend->get_scale(), *he_backend->get_ckks_encoder(), pool,
+              complex_packing);
+      EXPECT_DOUBLE_EQ(cipher->scale(), he_backend->get_scale());
+
+      HEPlaintext output;
+      decrypt(output, *cipher, complex_packing, *he_backend->get_decryptor(),
+              *he_backend->get_ckks_encoder(), context, plain.size());
+      EXPECT_TRUE(test::all_close(output.as_double_vec(),
+                                  std::vector<double>{1, 2, 3}, 1e-3));
+    }
+  }
+}
+
+TEST(seal_zero_encryption_pool, empty) {
+  auto backend = runtime::Backend::create("HE_SEAL");
+  auto he_backend = static_cast<HESealBackend*>(backend.get());
+  auto context = he_backend->get_context();
+
+  SealZeroEncryptionPool pool(context, *he_backend->get_encryptor(),
+                              context->first_parms_id(), 0);
+  pool.wait_until_full();
+  EXPECT_EQ(pool.size(), 0U);
+
+  seal::Ciphertext zero;
+  pool.get(zero);
+  EXPECT_EQ(zero.size(), 2U);
+  EXPECT_EQ(pool.miss_count(), 1U);
+}
+
+}  // namespace ngraph::runtime::he
@@ -20,6 +20,7 @@
 #include <thread>
 #include <vector>
 
+#include "he_op_annotations.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/op/util/op_annotations.hpp"
 #include "op/bounded_relu.hpp"
@@ -951,4 +952,212 @@ NGRAPH_TEST(${BACKEND_NAME},
       1e-3f));
 }
 
+NGRAPH_TEST(${BACKEND_NAME},
+            server_client_relu_max_pool_1d_1channel_1image_encrypted) {
+  auto backend = runtime::Backend::create("${BACKEND_NAME}");
+  auto he_backend = static_cast<HESealBackend*>(backend.get());
+  size_t batch_size = 1;
+
+  Shape shape_a{1, 1, 12};
+  Shape window_shape{3};
+  auto a = std::make_shared<op::Parameter>(element::f32, shape_a);
+  auto relu = std::make_shared<op::Relu>(a);
+  auto max_pool = std::make_shared<op::MaxPool>(relu, window_shape);
+  auto f = std::make_shared<Function>(max_pool, ParameterVector{a});
+
+  std::string error_str;
+  he_backend->set_config(
+      {{"enable_client", "true"}, {a->get_name(), "client_input,encrypt"}},
+      error_str);
+
+  // Server inputs which are not used
+  auto t_dummy = he_backend->create_plain_tensor(element::f32, shape_a);
+  auto t_result =
+      he_backend->create_cipher_tensor(element::f32, max_pool->get_shape());
+
+  // Used for dummy server inputs
+  float dummy_float = 99;
+  copy_data(t_dummy, std::vector<float>(shape_size(shape_a), dummy_float));
+
+  std::vector<float> results;
+  auto client_thread = std::thread([&]() {
+    std::vector<float> inputs{-1, -2, -3, 1, -4, -1, -5, 2, -3, -2, -1, -3};
+    auto he_client =
+        HESealClient("localhost", 34000, batch_size,
+                     HETensorConfigMap<float>{
+                         {a->get_name(), make_pair("encrypt", inputs)}});
+
+    auto double_results = he_client.get_results();
+    results = std::vector<float>(double_results.begin(), double_results.end());
+  });
+
+  auto handle =
+      std::static_pointer_cast<HESealExecutable>(he_backend->compile(f));
+
+  // The Relu is evaluated within the MaxPool round-trip
+  EXPECT_TRUE(HEOpAnnotations::client_fused(*relu));
+
+  handle->call_with_validate({t_result}, {t_dummy});
+
+  client_thread.join();
+  EXPECT_TRUE(test::all_close(
+      results,
+      ngraph::test::NDArray<float, 3>({{{0, 1, 1, 1, 0, 2, 2, 2, 0, 0}}})
+          .get_vector(),
+      1e-3f));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, server_client_client_op_sigmoid) {
+  auto backend = runtime::Backend::create("${BACKEND_NAME}");
+  auto he_backend = static_cast<HESealBackend*>(backend.get());
+  size_t batch_size = 1;
+
+  Shape shape{2, 3};
+  auto a = std::make_shared<op::Parameter>(element::f32, shape);
+  auto sigmoid = std::make_shared<op::Sigmoid>(a);
+  auto f = std::make_shared<Function>(sigmoid, ParameterVector{a});
+
+  std::string error_str;
+  he_backend->set_config({{"enable_client", "true"},
+                          {"client_ops", "Sigmoid"},
+                          {a->get_name(), "client_input,encrypt"}},
+                         error_str);
+  EXPECT_TRUE(he_backend->is_client_op(*sigmoid));
+
+  // Server inputs which are not used
+  auto t_dummy = he_backend->create_plain_tensor(element::f32, shape);
+  auto t_result = he_backend->create_cipher_tensor(element::f32, shape);
+
+  // Used for dummy server inputs
+  float dummy_float = 99;
+  copy_data(t_dummy, std::vector<float>(shape_size(shape), dummy_float));
+
+  std::vector<float> inputs{-3, -1, 0, 0.5, 1, 2};
+  std::vector<float> exp_results;
+  for (float input : inputs) {
+    exp_results.emplace_back(1 / (1 + std::exp(-input)));
+  }
+
+  std::vector<float> results;
+  auto client_thread = std::thread([&]() {
+    auto he_client =
+        HESealClient("localhost", 34000, batch_size,
+                     HETensorConfigMap<float>{
+                         {a->get_name(), make_pair("encrypt", inputs)}});
+
+    auto double_results = he_client.get_results();
+    results = std::vector<float>(double_results.begin(), double_results.end());
+  });
+
+  auto handle =
+      std::static_pointer_cast<HESealExecutable>(he_backend->compile(f));
+
+  handle->call_with_validate({t_result}, {t_dummy});
+
+  client_thread.join();
+  EXPECT_TRUE(test::all_close(results, exp_results, 1e-3f));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, server_client_refresh_max_levels) {
+  auto backend = runtime::Backend::create("${BACKEND_NAME}");
+  auto he_backend = static_cast<HESealBackend*>(backend.get());
+  size_t batch_size = 1;
+
+  Shape shape{batch_size, 3};
+  auto a = std::make_shared<op::Parameter>(element::f32, shape);
+  auto c = op::Constant::create(element::f32, shape, {2, 2, 2});
+  auto mult1 = std::make_shared<op::Multiply>(a, c);
+  auto mult2 = std::make_shared<op::Multiply>(mult1, c);
+  auto mult3 = std::make_shared<op::Multiply>(mult2, c);
+  auto f = std::make_shared<Function>(mult3, ParameterVector{a});
+
+  std::string error_str;
+  he_backend->set_config({{"enable_client", "true"},
+                          {"max_levels", "1"},
+                          {a->get_name(), "client_input,encrypt"}},
+                         error_str);
+
+  // Server inputs which are not used
+  auto t_dummy = he_backend->create_plain_tensor(element::f32, shape);
+  auto t_result = he_backend->create_cipher_tensor(element::f32, shape);
+
+  // Used for dummy server inputs
+  float dummy_float = 99;
+  copy_data(t_dummy, std::vector<float>{dummy_float, dummy_float, dummy_float});
+
+  std::vector<float> results;
+  auto client_thread = std::thread([&]() {
+    std::vector<float> inputs{1, 2, 3};
+    auto he_client =
+        HESealClient("localhost", 34000, batch_size,
+                     HETensorConfigMap<float>{
+                         {a->get_name(), make_pair("encrypt", inputs)}});
+
+    auto double_results = he_client.get_results();
+    results = std::vector<float>(double_results.begin(), double_results.end());
+  });
+
+  auto handle =
+      std::static_pointer_cast<HESealExecutable>(he_backend->compile(f));
+
+  handle->call_with_validate({t_result}, {t_dummy});
+
+  client_thread.join();
+  EXPECT_TRUE(HEOpAnnotations::refresh(*mult1));
+  EXPECT_TRUE(HEOpAnnotations::refresh(*mult2));
+  EXPECT_FALSE(HEOpAnnotations::refresh(*mult3));
+  EXPECT_TRUE(
+      test::all_close(results, std::vector<float>{8, 16, 24}, 1e-3f));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, server_client_multiple_results) {
+  auto backend = runtime::Backend::create("${BACKEND_NAME}");
+  auto he_backend = static_cast<HESealBackend*>(backend.get());
+  size_t batch_size = 1;
+
+  Shape shape{batch_size, 3};
+  auto a = std::make_shared<op::Parameter>(element::f32, shape);
+  auto c = op::Constant::create(element::f32, shape, {1, 2, 3});
+  auto add = std::make_shared<op::Add>(a, c);
+  auto mult = std::make_shared<op::Multiply>(add, c);
+  auto f =
+      std::make_shared<Function>(NodeVector{add, mult}, ParameterVector{a});
+
+  std::string error_str;
+  he_backend->set_config({{"enable_client", "true"},
+                          {a->get_name(), "client_input,encrypt"}},
+                         error_str);
+
+  // Server inputs which are not used
+  auto t_dummy = he_backend->create_plain_tensor(element::f32, shape);
+  auto t_add = he_backend->create_cipher_tensor(element::f32, shape);
+  auto t_mult = he_backend->create_cipher_tensor(element::f32, shape);
+
+  // Used for dummy server inputs
+  float dummy_float = 99;
+  copy_data(t_dummy, std::vector<float>{dummy_float, dummy_float, dummy_float});
+
+  std::vector<float> results;
+  auto client_thread = std::thread([&]() {
+    std::vector<float> inputs{1, 2, 3};
+    auto he_client =
+        HESealClient("localhost", 34000, batch_size,
+                     HETensorConfigMap<float>{
+                         {a->get_name(), make_pair("encrypt", inputs)}});
+
+    auto double_results = he_client.get_results();
+    results = std::vector<float>(double_results.begin(), double_results.end());
+  });
+
+  auto handle =
+      std::static_pointer_cast<HESealExecutable>(he_backend->compile(f));
+
+  handle->call_with_validate({t_add, t_mult}, {t_dummy});
+
+  client_thread.join();
+  // Results are concatenated in the order of the function's results
+  EXPECT_TRUE(test::all_close(
+      results, std::vector<float>{2, 4, 6, 2, 8, 18}, 1e-3f));
+}
+
 }  // namespace ngraph::runtime::he
@@ -164,6 +164,62 @@ NGRAPH_TEST(${BACKEND_NAME}, server_client_gc_add_3_relu) {
   EXPECT_TRUE(test::all_close(results, std::vector<float>{0, 0, 3.3}, 1e-1f));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, server_client_gc_relu_max_pool_not_fused) {
+  auto backend = Backend::create("${BACKEND_NAME}");
+  auto he_backend = static_cast<HESealBackend*>(backend.get());
+
+  size_t batch_size = 1;
+
+  Shape shape_a{1, 1, 12};
+  Shape window_shape{3};
+  auto a = std::make_shared<op::Parameter>(element::f32, shape_a);
+  auto relu = std::make_shared<op::Relu>(a);
+  auto max_pool = std::make_shared<op::MaxPool>(relu, window_shape);
+  auto f = std::make_shared<Function>(max_pool, ParameterVector{a});
+
+  std::string error_str;
+  he_backend->set_config(
+      std::map<std::string, std::string>{
+          {"enable_client", "true"},
+          {"enable_gc", "true"},
+          {"encryption_parameters", gc_param_real_str},
+          {a->get_name(), "client_input,encrypt"}},
+      error_str);
+
+  // Server inputs which are not used
+  auto t_dummy = he_backend->create_plain_tensor(element::f32, shape_a);
+  auto t_result =
+      he_backend->create_cipher_tensor(element::f32, max_pool->get_shape());
+
+  // Used for dummy server inputs
+  float DUMMY_FLOAT = 99;
+  copy_data(t_dummy, std::vector<float>(shape_size(shape_a), DUMMY_FLOAT));
+
+  std::vector<float> results;
+  auto client_thread = std::thread([&]() {
+    std::vector<float> inputs{-1, -2, -3, 1, -4, -1, -5, 2, -3, -2, -1, -3};
+    auto he_client =
+        HESealClient("localhost", 34000, batch_size,
+                     HETensorConfigMap<float>{
+                         {a->get_name(), make_pair("encrypt", inputs)}});
+
+    auto double_results = he_client.get_results();
+    results = std::vector<float>(double_results.begin(), double_results.end());
+  });
+
+  auto handle =
+      std::static_pointer_cast<HESealExecutable>(he_backend->compile(f));
+
+  // A fused round-trip would reveal the pre-activation values to the client
+  EXPECT_FALSE(HEOpAnnotations::client_fused(*relu));
+
+  handle->call_with_validate({t_result}, {t_dummy});
+
+  client_thread.join();
+  EXPECT_TRUE(test::all_close(
+      results, std::vector<float>{0, 1, 1, 1, 0, 2, 2, 2, 0, 0}, 1e-1f));
+}
+
 auto server_client_gc_relu_packed_test = [](size_t element_count,
                                             size_t batch_size,
                                             bool complex_packing,
@@ -15,7 +15,11 @@
 //*****************************************************************************
 
 #include <chrono>
+#include <cstdio>
+#include <fstream>
 #include <memory>
+#include <set>
+#include <vector>
 
 #include "boost/asio.hpp"
 #include "gtest/gtest.h"
@@ -26,7 +30,9 @@
 #include "seal/seal_ciphertext_wrapper.hpp"
 #include "tcp/tcp_client.hpp"
 #include "tcp/tcp_message.hpp"
+#include "tcp/tcp_message_dispatcher.hpp"
 #include "tcp/tcp_session.hpp"
+#include "tcp/tcp_transport.hpp"
 #include "util/test_tools.hpp"
 
 namespace ngraph::runtime::he {
@@ -127,8 +133,7 @@ class MockClient {
   MockClient(std::string hostname, size_t port, size_t max_message_count)
       : m_max_message_count{max_message_count} {
     boost::asio::io_context io_context;
-    boost::asio::ip::tcp::resolver resolver(io_context);
-    auto endpoints = resolver.resolve(hostname, std::to_string(port));
+    auto endpoints = resolve_endpoints(io_context, hostname, port);
     auto client_callback = [this](const TCPMessage& message) {
       m_message_count++;
 
@@ -183,4 +188,152 @@ TEST(tcp_client, non_empty_message_queue) {
   client_thread.join();
 }
 
+TEST(tcp_client, striped_connections) {
+  size_t port{34000};
+  std::string hostname{"localhost"};
+  size_t num_connections{4};
+  size_t chunk_count{64};
+
+  std::mutex received_mutex;
+  std::condition_variable received_cond;
+  std::multiset<size_t> received_offsets;
+
+  // Server accepts every connection into sessions sharing one dispatcher
+  boost::asio::io_context server_io_context;
+  boost::asio::ip::tcp::acceptor acceptor(
+      server_io_context,
+      boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v4(), port));
+  auto server_dispatcher =
+      std::make_shared<TCPMessageDispatcher>([&](const TCPMessage& message) {
+        // Delay handling, so chunks queue up on every connection
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        std::lock_guard<std::mutex> guard(received_mutex);
+        received_offsets.insert(message.pb_message()->he_tensors(0).offset());
+        received_cond.notify_all();
+      });
+  std::vector<std::shared_ptr<TCPSession>> sessions;
+  std::function<void()> accept = [&]() {
+    acceptor.async_accept([&](boost::system::error_code ec,
+                              boost::asio::ip::tcp::socket socket) {
+      ASSERT_FALSE(ec);
+      sessions.emplace_back(
+          std::make_shared<TCPSession>(std::move(socket), server_dispatcher));
+      sessions.back()->start();
+      if (sessions.size() < num_connections) {
+        accept();
+      }
+    });
+  };
+  accept();
+  auto server_thread = std::thread([&]() { server_io_context.run(); });
+
+  // Client stripes chunks round-robin across its connections
+  boost::asio::io_context client_io_context;
+  auto endpoints = resolve_endpoints(client_io_context, hostname, port);
+  auto client_dispatcher =
+      std::make_shared<TCPMessageDispatcher>([](const TCPMessage&) {});
+  std::vector<std::unique_ptr<TCPClient>> clients;
+  for (size_t i = 0; i < num_connections; ++i) {
+    clients.emplace_back(std::make_unique<TCPClient>(
+        client_io_context, endpoints, client_dispatcher));
+  }
+  auto client_thread = std::thread([&]() { client_io_context.run(); });
+  for (const auto& client : clients) {
+    while (!client->connected()) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
+
+  for (size_t offset = 0; offset < chunk_count; ++offset) {
+    pb::TCPMessage pb_message;
+    pb_message.set_type(pb::TCPMessage_Type_REQUEST);
+    pb_message.add_he_tensors()->set_offset(offset);
+    auto& client = clients[offset % num_connections];
+    client->wait_for_write_queue(2);
+    client->write_message(TCPMessage(std::move(pb_message)));
+  }
+
+  {
+    std::unique_lock<std::mutex> mlock(received_mutex);
+    received_cond.wait(
+        mlock, [&]() { return received_offsets.size() == chunk_count; });
+  }
+  for (const auto& client : clients) {
+    client->close();
+  }
+  client_thread.join();
+  server_thread.join();
+
+  EXPECT_EQ(sessions.size(), num_connections);
+  for (size_t offset = 0; offset < chunk_count; ++offset) {
+    EXPECT_EQ(received_offsets.count(offset), 1U);
+  }
+}
+
+TEST(tcp_client, unix_domain_socket) {
+  std::string socket_path{"/tmp/he_test_tcp_client.sock"};
+  size_t message_count{10};
+
+  std::mutex received_mutex;
+  std::condition_variable received_cond;
+  size_t received_count{0};
+
+  boost::asio::io_context server_io_context;
+  auto acceptor = open_acceptor(server_io_context, socket_path, 0);
+  std::shared_ptr<TCPSession> session;
+  acceptor->async_accept(
+      [&](boost::system::error_code ec, stream_socket socket) {
+        ASSERT_FALSE(ec);
+        session = std::make_shared<TCPSession>(
+            std::move(socket), [&](const TCPMessage& message) {
+              EXPECT_EQ(message.pb_message()->function().function(), "123");
+              std::lock_guard<std::mutex> guard(received_mutex);
+              received_count++;
+              received_cond.notify_all();
+            });
+        session->start();
+      });
+  auto server_thread = std::thread([&]() { server_io_context.run(); });
+
+  boost::asio::io_context client_io_context;
+  auto endpoints =
+      resolve_endpoints(client_io_context, "unix:" + socket_path, 0);
+  ASSERT_EQ(endpoints.size(), 1U);
+  TCPClient client(client_io_context, endpoints, [](const TCPMessage&) {});
+  auto client_thread = std::thread([&]() { client_io_context.run(); });
+  while (!client.connected()) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  for (size_t i = 0; i < message_count; ++i) {
+    client.write_message(dummy_tcp_message());
+  }
+
+  {
+    std::unique_lock<std::mutex> mlock(received_mutex);
+    received_cond.wait(mlock,
+                       [&]() { return received_count == message_count; });
+  }
+  client.close();
+  client_thread.join();
+  server_thread.join();
+  std::remove(socket_path.c_str());
+}
+
+TEST(tcp_client, unix_domain_socket_path_not_socket) {
+  std::string socket_path{"/tmp/he_test_tcp_client_not_socket"};
+  {
+    std::ofstream file(socket_path);
+    file << "not a socket";
+  }
+
+  boost::asio::io_context io_context;
+  EXPECT_ANY_THROW(open_acceptor(io_context, socket_path, 0));
+
+  // The file is left untouched
+  std::ifstream file(socket_path);
+  EXPECT_TRUE(file.good());
+  file.close();
+  std::remove(socket_path.c_str());
+}
+
 }  // namespace ngraph::runtime::he
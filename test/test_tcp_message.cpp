@@ -18,13 +18,18 @@
 
 #include <chrono>
 #include <memory>
+#include <vector>
 
+#include "boost/asio.hpp"
 #include "gtest/gtest.h"
+#include "he_tensor.hpp"
 #include "protos/message.pb.h"
 #include "seal/he_seal_backend.hpp"
 #include "seal/seal.h"
 #include "seal/seal_ciphertext_wrapper.hpp"
 #include "tcp/tcp_message.hpp"
+#include "test_util.hpp"
+#include "util/all_close.hpp"
 #include "util/test_tools.hpp"
 
 namespace ngraph::runtime::he {
@@ -54,6 +59,12 @@ TEST(tcp_message, encode_decode) {
   TCPMessage::encode_header(buffer, encode_size);
   size_t decoded_size = TCPMessage::decode_header(buffer);
   EXPECT_EQ(decoded_size, encode_size);
+  EXPECT_EQ(TCPMessage::decode_payload_header(buffer), 0);
+
+  size_t payload_size = 1000;
+  TCPMessage::encode_header(buffer, encode_size, payload_size);
+  EXPECT_EQ(TCPMessage::decode_header(buffer), encode_size);
+  EXPECT_EQ(TCPMessage::decode_payload_header(buffer), payload_size);
 }
 
 TEST(tcp_message, pack_unpack) {
@@ -77,4 +88,56 @@ TEST(tcp_message, pack_unpack) {
       *message1.pb_message(), *message2.pb_message()));
 }
 
+TEST(tcp_message, raw_payloads) {
+  auto backend = runtime::Backend::create("HE_SEAL");
+  auto he_backend = static_cast<HESealBackend*>(backend.get());
+
+  Shape shape{2, 3};
+  auto tensor = std::static_pointer_cast<HETensor>(
+      he_backend->create_cipher_tensor(element::f32, shape));
+  std::vector<float> values{1, 2, 3, 4, 5, 6};
+  copy_data(tensor, values);
+
+  std::vector<CiphertextPayloads> payloads;
+  auto pb_tensors = tensor->write_to_pb_tensors(seal::compr_mode_type::none,
+                                                false, &payloads);
+  ASSERT_EQ(pb_tensors.size(), 1);
+  ASSERT_EQ(payloads.size(), 1);
+  ASSERT_EQ(payloads[0].size(), shape_size(shape));
+  // Ciphertexts are referenced, rather than copied into the proto tensor
+  EXPECT_EQ(payloads[0][0], tensor->data(0).get_ciphertext());
+  EXPECT_TRUE(pb_tensors[0].data(0).has_raw_ciphertext());
+  EXPECT_TRUE(pb_tensors[0].data(0).ciphertext().empty());
+
+  pb::TCPMessage pb_msg;
+  *pb_msg.add_he_tensors() = pb_tensors[0];
+  TCPMessage message1(std::move(pb_msg), std::move(payloads[0]));
+
+  TCPMessage::data_buffer buffer;
+  message1.pack(buffer);
+  auto write_buffers = message1.write_buffers(buffer);
+  EXPECT_EQ(write_buffers.size(), 1 + shape_size(shape));
+
+  // Gather the frame, as written to the socket
+  std::vector<char> frame(boost::asio::buffer_size(write_buffers));
+  boost::asio::buffer_copy(boost::asio::buffer(frame), write_buffers);
+  size_t payload_size = TCPMessage::decode_payload_header(buffer);
+  EXPECT_EQ(frame.size(), buffer.size() + payload_size);
+
+  TCPMessage message2;
+  message2.unpack(buffer);
+  auto read_buffers = message2.allocate_payloads(he_backend->get_context());
+  ASSERT_EQ(boost::asio::buffer_size(read_buffers), payload_size);
+  boost::asio::buffer_copy(
+      read_buffers,
+      boost::asio::buffer(frame.data() + buffer.size(), payload_size));
+
+  auto loaded = HETensor::load_from_pb_tensor(
+      message2.pb_message()->he_tensors(0), *he_backend->get_ckks_encoder(),
+      he_backend->get_context(), *he_backend->get_encryptor(),
+      *he_backend->get_decryptor(), he_backend->get_encryption_parameters(),
+      message2.payloads());
+  EXPECT_TRUE(test::all_close(read_vector<float>(loaded), values, 1e-3f));
+}
+
 }  // namespace ngraph::runtime::he
@@ -0,0 +1,78 @@
+//*****************************************************************************
+// Copyright 2018-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "protos/message.pb.h"
+#include "tcp/tcp_message.hpp"
+#include "tcp/tcp_message_dispatcher.hpp"
+
+namespace ngraph::runtime::he {
+
+TEST(tcp_message_dispatcher, preserves_order) {
+  std::vector<std::string> functions;
+  std::thread::id caller_id = std::this_thread::get_id();
+  bool handled_on_caller = false;
+  size_t message_count = 100;
+  {
+    TCPMessageDispatcher dispatcher(
+        [&](const TCPMessage& message) {
+          handled_on_caller |= std::this_thread::get_id() == caller_id;
+          functions.emplace_back(message.pb_message()->function().function());
+        },
+        4);
+
+    for (size_t msg_idx = 0; msg_idx < message_count; ++msg_idx) {
+      pb::TCPMessage pb_message;
+      pb_message.mutable_function()->set_function(std::to_string(msg_idx));
+      TCPMessage message(std::move(pb_message));
+      if (msg_idx % 2 == 0) {
+        // Frame unpacked by the dispatcher
+        auto buffer = dispatcher.acquire_buffer();
+        message.pack(buffer);
+        dispatcher.dispatch(std::move(buffer));
+      } else {
+        dispatcher.dispatch(std::move(message));
+      }
+    }
+    // Destructor waits for dispatched messages
+  }
+
+  EXPECT_FALSE(handled_on_caller);
+  ASSERT_EQ(functions.size(), message_count);
+  for (size_t msg_idx = 0; msg_idx < message_count; ++msg_idx) {
+    EXPECT_EQ(functions[msg_idx], std::to_string(msg_idx));
+  }
+}
+
+TEST(tcp_message_dispatcher, buffer_pool) {
+  TCPMessageDispatcher dispatcher([](const TCPMessage& /* message */) {});
+
+  auto buffer = dispatcher.acquire_buffer();
+  EXPECT_EQ(buffer.size(), TCPMessage::header_length);
+  buffer.resize(1000);
+  const char* data = buffer.data();
+  dispatcher.release_buffer(std::move(buffer));
+
+  // Released buffers are reused
+  auto reused = dispatcher.acquire_buffer();
+  EXPECT_EQ(reused.data(), data);
+}
+
+}  // namespace ngraph::runtime::he
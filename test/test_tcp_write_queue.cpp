@@ -0,0 +1,95 @@
+//*****************************************************************************
+// Copyright 2018-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "boost/asio.hpp"
+#include "gtest/gtest.h"
+#include "protos/message.pb.h"
+#include "tcp/tcp_message.hpp"
+#include "tcp/tcp_transport.hpp"
+#include "tcp/tcp_write_queue.hpp"
+
+namespace ngraph::runtime::he {
+
+TEST(tcp_write_queue, multiple_producers) {
+  boost::asio::io_context io_context;
+  boost::asio::ip::tcp::acceptor acceptor(
+      io_context, boost::asio::ip::tcp::endpoint(
+                      boost::asio::ip::address_v4::loopback(), 0));
+  stream_socket write_socket(io_context);
+  write_socket.connect(acceptor.local_endpoint());
+  boost::asio::ip::tcp::socket read_socket = acceptor.accept();
+
+  bool write_error = false;
+  auto write_queue = std::make_shared<TCPWriteQueue>(
+      write_socket,
+      [&](const boost::system::error_code& /* ec */) { write_error = true; });
+
+  size_t thread_count = 4;
+  size_t messages_per_thread = 50;
+  auto io_work = boost::asio::make_work_guard(io_context);
+  std::thread io_thread([&]() { io_context.run(); });
+
+  std::vector<std::thread> producers;
+  for (size_t thread_idx = 0; thread_idx < thread_count; ++thread_idx) {
+    producers.emplace_back([&, thread_idx]() {
+      for (size_t msg_idx = 0; msg_idx < messages_per_thread; ++msg_idx) {
+        pb::TCPMessage pb_message;
+        pb_message.mutable_function()->set_function(
+            std::to_string(thread_idx * messages_per_thread + msg_idx));
+        write_queue->wait_for_size(8);
+        write_queue->push(TCPMessage(std::move(pb_message)));
+      }
+    });
+  }
+
+  // Read each message back, in whichever order the producers interleaved
+  std::set<std::string> functions;
+  TCPMessage::data_buffer buffer(TCPMessage::header_length);
+  for (size_t msg_idx = 0; msg_idx < thread_count * messages_per_thread;
+       ++msg_idx) {
+    buffer.resize(TCPMessage::header_length);
+    boost::asio::read(read_socket, boost::asio::buffer(buffer));
+    size_t body_length = TCPMessage::decode_header(buffer);
+    EXPECT_EQ(TCPMessage::decode_payload_header(buffer), 0);
+    buffer.resize(TCPMessage::header_length + body_length);
+    boost::asio::read(read_socket,
+                      boost::asio::buffer(&buffer[TCPMessage::header_length],
+                                          body_length));
+    TCPMessage message;
+    ASSERT_TRUE(message.unpack(buffer));
+    functions.insert(message.pb_message()->function().function());
+  }
+
+  for (auto& producer : producers) {
+    producer.join();
+  }
+  write_queue->wait_for_size(1);
+  EXPECT_TRUE(write_queue->empty());
+  EXPECT_FALSE(write_error);
+  EXPECT_EQ(functions.size(), thread_count * messages_per_thread);
+
+  io_work.reset();
+  io_context.stop();
+  io_thread.join();
+}
+
+}  // namespace ngraph::runtime::he